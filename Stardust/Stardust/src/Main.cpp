@@ -1,10 +1,25 @@
 #include <cstdlib>
+#include <string_view>
 
 #include "sandbox/TestScene.h"
 #include "stardust/Stardust.h"
 
-int main([[maybe_unused]] const int argc, char* argv[])
+int main(const int argc, char* argv[])
 {
+	if (argc >= 4 && std::string_view(argv[1]) == "--cook-textures")
+	{
+		return stardust::cooked_texture::CookDirectory(argv[2], argv[3]) > 0u
+			? EXIT_SUCCESS
+			: EXIT_FAILURE;
+	}
+
+	if (argc >= 4 && std::string_view(argv[1]) == "--pack-archive")
+	{
+		return stardust::vfs::pak::PackDirectory(argv[2], argv[3]) == stardust::Status::Success
+			? EXIT_SUCCESS
+			: EXIT_FAILURE;
+	}
+
 	const stardust::Application::FilepathsInfo gameFilepaths{
 		.windowIcon = "assets/icon/icon.png",
 		.config = "config/config.json",
@@ -24,13 +39,22 @@ int main([[maybe_unused]] const int argc, char* argv[])
 		.positionIterations = 3u,
 	};
 
+	const stardust::Application::AssetCacheInfo assetCacheInfo{
+		.textureMemoryBudget = 256'000'000u,
+		.soundMemoryBudget = 128'000'000u,
+		.fontMemoryBudget = 16'000'000u,
+	};
+
 	stardust::Application game({
 		.title = "Stardust",
 		.filepaths = gameFilepaths,
 		.filesystem = filesystemInfo,
 		.physics = physicsInfo,
 		.requireRenderToTexture = true,
+		.useDeferredRendering = true,
+		.useDirtyRectRendering = false,
 		.rendererLogicalSize = glm::uvec2{ 1920u, 1080u },
+		.assetCache = assetCacheInfo,
 	});
 
 	if (!game.DidInitialiseSuccessfully())
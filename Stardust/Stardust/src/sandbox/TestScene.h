@@ -49,8 +49,7 @@ class TestScene
 {
 private:
 	sd::AssetManager<sd::Texture> m_textures;
-	sd::AssetManager<sd::Sound> m_sounds;
-	sd::AssetManager<sd::Font> m_fonts;
+	sd::TexturePacker m_spriteAtlas;
 
 	sd::Entity m_drawable;
 	sd::ParticleSystem m_particles;
@@ -58,6 +57,9 @@ private:
 	float m_clickParticleDelay = 0.01f;
 
 	sd::TextureAtlas m_textureAtlas;
+	sd::TextureAtlas::SubtextureIndex m_leftConveyorSubtexture = 0u;
+	sd::TextureAtlas::SubtextureIndex m_rightConveyorSubtexture = 0u;
+	sd::RenderLayer m_decorationLayer;
 	
 	sd_phys::World m_physicsWorld;
 
@@ -72,27 +74,23 @@ public:
 
 	[[nodiscard]] virtual sd::Status OnLoad() override
 	{
-		const auto textures = sd::vfs::GetAllFilesInDirectory("assets/textures");
+		const unsigned int packedTextureCount = m_spriteAtlas.AddDirectory("assets/textures", m_application.GetTextureLoader());
 
-		for (const auto textureFile : textures)
+		if (packedTextureCount == 0u || m_spriteAtlas.Pack() == sd::Status::Fail || m_spriteAtlas.Upload(m_application.GetRenderer()) == sd::Status::Fail)
 		{
-			const auto textureName = sd::vfs::GetFileStem(textureFile);
-			m_textures.Add(textureName, m_application.GetRenderer(), textureFile);
+			sd::Log::Error("Textures in \"{}\" failed to pack.", "assets/textures");
 
-			if (!m_textures[textureName].IsValid())
-			{
-				sd::Log::Error("Texture \"{}\" failed to load.", textureFile);
-
-				return sd::Status::Fail;
-			}
+			return sd::Status::Fail;
+		}
 
-			m_textures[textureName].SetScaleMode(sd::Texture::ScaleMode::Nearest);
-			sd::Log::Trace("Texture \"{}\" loaded successfully.", textureFile);
+		for (auto& page : m_spriteAtlas.GetPages())
+		{
+			page.SetScaleMode(sd::Texture::ScaleMode::Nearest);
 		}
 
-		m_sounds.Add("test", "assets/sounds/test.wav");
+		sd::Log::Trace("{} textures packed into {} texture page(s).", packedTextureCount, m_spriteAtlas.GetPageCount());
 
-		if (!m_sounds["test"].IsValid())
+		if (m_assets.AddSound("test", "assets/sounds/test.wav") == sd::Status::Fail)
 		{
 			sd::Log::Error("Sound \"{}\" failed to load.", "assets/sounds/test.wav");
 
@@ -101,16 +99,14 @@ public:
 
 		sd::Log::Trace("Sound \"{}\" loaded successfully.", "assets/sounds/test.wav");
 
-		m_fonts.Add("arial", "assets/fonts/arial.ttf", 64u);
-
-		if (!m_fonts["arial"].IsValid())
+		if (m_assets.AddFont("arial", "assets/fonts/arial.ttf", 64u) == sd::Status::Fail)
 		{
 			sd::Log::Error("Font \"{}\" failed to load.", "assets/fonts/arial.ttf");
 
 			return sd::Status::Fail;
 		}
 
-		m_textures.Add("text", sd::text::RenderTextWithOutline(m_application.GetRenderer(), m_fonts["arial"], "This is some text.", sd::colours::Pink, 4u, sd::colours::Purple));
+		m_textures.Add("text", sd::text::RenderTextWithOutline(m_application.GetRenderer(), m_assets.GetFont("arial"), "This is some text.", sd::colours::Pink, 4u, sd::colours::Purple));
 
 		sd::Log::Trace("Font \"{}\" loaded successfully.", "assets/fonts/arial.ttf");
 
@@ -124,11 +120,23 @@ public:
 		);
 		m_drawable.AddComponent<Velocity>(0.0f, 0.0f);
 		m_drawable.AddComponent<Rotater>(360.0f);
-		m_drawable.AddComponent<sd_comp::SpriteRendererComponent>(m_textures["gear"], glm::vec2{ 1.0f, 1.0f });
+		m_drawable.AddComponent<sd_comp::SpriteRendererComponent>(*m_spriteAtlas["gear"].texture, glm::vec2{ 1.0f, 1.0f }, 0, m_spriteAtlas["gear"].area);
 
 		m_particles.SetGravity(glm::vec2{ 0.0f, 250.0f });
 
 		m_textureAtlas.Initialise(m_application.GetRenderer(), "assets/textures/texture_atlases/conveyors.taj");
+
+		if (!m_textureAtlas.IsTextureValid() || !m_textureAtlas.GetSubtextureIndex("left").has_value() || !m_textureAtlas.GetSubtextureIndex("right").has_value())
+		{
+			sd::Log::Error("Texture atlas \"{}\" failed to load.", "assets/textures/texture_atlases/conveyors.taj");
+
+			return sd::Status::Fail;
+		}
+
+		m_leftConveyorSubtexture = m_textureAtlas.GetSubtextureIndex("left").value();
+		m_rightConveyorSubtexture = m_textureAtlas.GetSubtextureIndex("right").value();
+
+		m_decorationLayer.Initialise(m_application.GetRenderer(), m_application.GetRenderer().GetLogicalSize());
 		m_physicsWorld.Initialise(glm::vec2{ 0.0f, -9.81f });
 
 		m_camera.Initialise(m_application.GetRenderer(), 8.0f);
@@ -139,6 +147,7 @@ public:
 	virtual void OnUnload() noexcept override
 	{
 		m_textures.Clear();
+		m_spriteAtlas.Destroy();
 		m_entityRegistry.clear();
 	}
 
@@ -205,13 +214,13 @@ public:
 
 		if (sd::Input::GetKeyboardState().IsKeyDown(sd::KeyCode::Space))
 		{
-			m_sounds["test"].SetVolume(m_application.GetVolumeManager()[sd::VolumeManager::GetMasterVolumeName()]);
-			soundSource = m_application.GetSoundSystem().PlaySound(m_sounds["test"]);
+			m_assets.GetSound("test").SetVolume(m_application.GetVolumeManager()[sd::VolumeManager::GetMasterVolumeID()]);
+			soundSource = m_application.GetSoundSystem().PlaySound(m_assets.GetSound("test"));
 		}
 		else if (sd::Input::GetKeyboardState().IsKeyDown(sd::KeyCode::B)) 
 		{
-			m_sounds["test"].SetVolume(0.25f);
-			soundSource = m_application.GetSoundSystem().PlaySound(m_sounds["test"]);
+			m_assets.GetSound("test").SetVolume(0.25f);
+			soundSource = m_application.GetSoundSystem().PlaySound(m_assets.GetSound("test"));
 		}
 
 		if (sd::Input::GetKeyboardState().IsKeyDown(sd::KeyCode::Enter))
@@ -295,7 +304,7 @@ public:
 			{
 				m_particleCounter = 0.0f;
 				m_particles.Emit(sd::ParticleSystem::ParticleData{
-					.initialPosition = m_camera.WorldSpaceToScreenSpace(transform.position * m_camera.GetZoom()),
+					.initialPosition = m_camera.WorldSpaceToScreenSpace(transform.position),
 					.initialRotation = 0.0f,
 					.minVelocity = { -160.0f, -160.0f },
 					.maxVelocity = { 160.0f, 160.0f },
@@ -310,8 +319,8 @@ public:
 					.keepAsSquare = true,
 					.startColour = sd::colours::Grey,
 					.endColour = sd::colours::White,
-					.texture = &m_textures["particle"],
-					.textureArea = std::nullopt,
+					.texture = m_spriteAtlas["particle"].texture,
+					.textureArea = m_spriteAtlas["particle"].area,
 					.minLifetime = 0.5f,
 					.maxLifetime = 3.25f,
 				});
@@ -323,28 +332,31 @@ public:
 
 	virtual void Render(const sd::Renderer& renderer) const override
 	{
+		renderer.SetSortLayer(0u);
 		m_particles.Render(renderer);
 
-		m_entityRegistry.sort<sd_comp::SpriteRendererComponent>([](const auto& lhs, const auto& rhs)
-		{
-			return lhs.z < rhs.z;
-		});
-
+		renderer.SetSortLayer(1u);
 		const auto renderableEntities = m_entityRegistry.view<sd_comp::TransformComponent, sd_comp::SpriteRendererComponent>();
 
 		renderableEntities.each([this, &renderer](auto& transform, auto& spriteRenderer)
 		{
+			renderer.SetSortZ(spriteRenderer.z);
 			renderer.DrawRotatedTexture(
 				*spriteRenderer.texture,
 				spriteRenderer.renderArea,
-				m_camera.WorldSpaceToScreenSpace(transform.position * m_camera.GetZoom()),
+				m_camera.WorldSpaceToScreenSpace(transform.position),
 				transform.scale * m_camera.GetZoom(),
-				transform.rotation
+				transform.rotation + m_camera.GetRotation()
 			);
 		});
 
-		renderer.DrawTexture(m_textureAtlas.GetTexture(), m_textureAtlas["left"], m_camera.WorldSpaceToScreenSpace(glm::vec2{ -6.0f, 3.0f }), glm::vec2{ 4.0f, 4.0f });
-		renderer.DrawTexture(m_textureAtlas.GetTexture(), m_textureAtlas["right"], m_camera.WorldSpaceToScreenSpace(glm::vec2{ -5.0f, 3.0f }), glm::vec2{ 4.0f, 4.0f });
+		renderer.SetSortLayer(2u);
+		renderer.SetSortZ(0);
+		m_decorationLayer.Draw([this](const sd::Renderer& renderer)
+		{
+			renderer.DrawTexture(m_textureAtlas.GetTexture(), m_textureAtlas[m_leftConveyorSubtexture], m_camera.WorldSpaceToScreenSpace(glm::vec2{ -6.0f, 3.0f }), glm::vec2{ 4.0f, 4.0f } * m_camera.GetZoom());
+			renderer.DrawTexture(m_textureAtlas.GetTexture(), m_textureAtlas[m_rightConveyorSubtexture], m_camera.WorldSpaceToScreenSpace(glm::vec2{ -5.0f, 3.0f }), glm::vec2{ 4.0f, 4.0f } * m_camera.GetZoom());
+		}, m_camera);
 
 		renderer.DrawTexture(m_textures["text"], std::nullopt, glm::vec2{ 10.0f, 10.0f }, glm::vec2{ 1.0f, 1.0f });
 	}
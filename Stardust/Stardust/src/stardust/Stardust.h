@@ -3,11 +3,14 @@
 #define STARDUST_H
 
 #include "application/Application.h"
+#include "assets/AssetCache.h"
 #include "assets/AssetManager.h"
+#include "assets/AssetSet.h"
 
 #include "audio/Listener.h"
 #include "audio/sounds/SoundBase.h"
 #include "audio/sounds/SoundEnums.h"
+#include "audio/sounds/SoundFile.h"
 #include "audio/sounds/Sounds.h"
 #include "audio/SoundSource.h"
 #include "audio/SoundSystem.h"
@@ -21,9 +24,19 @@
 #include "graphics/Colour.h"
 #include "graphics/display/Display.h"
 #include "graphics/renderer/Renderer.h"
+#include "graphics/renderer/command_buffer/CommandBuffer.h"
+#include "graphics/renderer/command_buffer/CommandRecorder.h"
+#include "graphics/renderer/primitive_batch/PrimitiveBatch.h"
+#include "graphics/renderer/render_layer/RenderLayer.h"
+#include "graphics/renderer/sprite_batch/SpriteBatch.h"
+#include "graphics/screenshot/ScreenshotWriter.h"
 #include "graphics/surface/PixelSurface.h"
 #include "graphics/texture/Texture.h"
+#include "graphics/texture/cooked_texture/CookedTexture.h"
+#include "graphics/texture/dynamic_texture/DynamicTexture.h"
 #include "graphics/texture/texture_atlas/TextureAtlas.h"
+#include "graphics/texture/texture_loader/TextureLoader.h"
+#include "graphics/texture/texture_packer/TexturePacker.h"
 #include "graphics/window/Window.h"
 
 #include "input/Input.h"
@@ -46,12 +59,21 @@
 #include "text/text_input/TextInput.h"
 #include "text/Text.h"
 
+#include "tilemap/Tilemap.h"
+
+#include "utility/binary/Binary.h"
 #include "utility/cpu/CPU.h"
 #include "utility/enums/Status.h"
 #include "utility/interfaces/INoncopyable.h"
 #include "utility/interfaces/INonmovable.h"
 #include "utility/random/Random.h"
+#include "utility/string_id/StringID.h"
+#include "utility/threading/WorkerQueue.h"
 
+#include "vfs/AsyncReader.h"
+#include "vfs/FileView.h"
+#include "vfs/pak/Pak.h"
+#include "vfs/Stream.h"
 #include "vfs/VFS.h"
 
 #endif
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include "Application.h"
 
-#include <chrono>
 #include <functional>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -9,11 +9,9 @@
 #include <magic_enum/magic_enum.hpp>
 #include <SDL2/SDL_ttf.h>
 #include <stb/stb_image.h>
-#include <stb/stb_image_write.h>
 
 #include "../debug/logging/Log.h"
 #include "../debug/message_box/MessageBox.h"
-#include "../graphics/surface/PixelSurface.h"
 #include "../input/Input.h"
 #include "../input/KeyCode.h"
 #include "../physics/world/World.h"
@@ -33,9 +31,25 @@ namespace stardust
 	{
 		m_entityRegistry.clear();
 
+		while (!m_sceneManager.IsEmpty())
+		{
+			m_sceneManager.PopScene();
+		}
+
+		m_textureCache.Clear();
+		m_soundCache.Clear();
+		m_fontCache.Clear();
+
 		Input::RemoveAllGameControllers();
 
+		m_screenshotWriter.Destroy();
+		m_textureLoader.Destroy();
+		m_asyncReader.Destroy();
+		m_commandRecorder.Destroy();
+
+		m_frameTexture.Destroy();
 		m_renderer.Destroy();
+		m_headlessSurface.Destroy();
 		m_window.Destroy();
 
 		vfs::Quit();
@@ -59,6 +73,8 @@ namespace stardust
 
 			m_soundSystem.Update();
 			PollEvents(event);
+			m_textureLoader.ProcessUploads();
+			m_asyncReader.ProcessCompletions();
 
 			while (timeAccumulator >= m_fixedTimestep)
 			{
@@ -71,6 +87,14 @@ namespace stardust
 			LateUpdate();
 
 			Render();
+			ProcessCompletedScreenshots();
+
+			++m_frameCount;
+
+			if (m_isHeadless && m_headlessFrameLimit != 0u && m_frameCount >= m_headlessFrameLimit)
+			{
+				m_isRunning = false;
+			}
 
 			UpdateSceneQueue();
 		}
@@ -88,35 +112,26 @@ namespace stardust
 
 	void Application::TakeScreenshot()
 	{
-		const PixelSurface pixelData = m_renderer.ReadPixels();
+		m_screenshotWriter.RequestCapture();
+	}
+
+	void Application::TakeScreenshotBurst(const unsigned int frameCount)
+	{
+		m_screenshotWriter.RequestCapture(frameCount);
+	}
 
-		if (!pixelData.IsValid())
+	void Application::SetDirtyRectRendering(const bool enableDirtyRectRendering)
+	{
+		if (enableDirtyRectRendering && !m_frameTexture.IsValid() && !CreateFrameTexture())
 		{
-			message_box::Show(m_locale["warnings"]["titles"]["screenshot"], m_locale["warnings"]["bodies"]["screenshot"], message_box::Type::Warning);
-			Log::EngineWarn("Failed to take screenshot.");
+			Log::EngineWarn("Dirty rectangle rendering requires render to texture support; rendering full frames instead.");
+			m_isDirtyRectRenderingEnabled = false;
 
 			return;
 		}
-		
-		const unsigned long long currentTime = static_cast<unsigned long long>(std::chrono::system_clock::now().time_since_epoch().count());
-		const std::string screenshotFilename = m_screenshotDirectory + "/screenshot_" + std::to_string(currentTime) + ".png";
 
-		if (stbi_write_png(
-			screenshotFilename.c_str(),
-			static_cast<int>(pixelData.GetSize().x),
-			static_cast<int>(pixelData.GetSize().y),
-			static_cast<int>(pixelData.GetPitch() / pixelData.GetSize().x),
-			pixelData.GetPixels(),
-			static_cast<int>(pixelData.GetPitch())
-		) == 0)
-		{
-			message_box::Show(m_locale["warnings"]["titles"]["screenshot"], m_locale["warnings"]["bodies"]["screenshot"], message_box::Type::Warning);
-			Log::EngineWarn("Failed to take screenshot.");
-		}
-		else
-		{
-			Log::EngineTrace("Screenshot captured at {}.", screenshotFilename);
-		}
+		m_isDirtyRectRenderingEnabled = enableDirtyRectRendering;
+		m_renderer.MarkFrameDirty();
 	}
 
 	[[nodiscard]] std::string Application::GetPlatformName() const
@@ -124,12 +139,12 @@ namespace stardust
 		return SDL_GetPlatform();
 	}
 
-	std::any& Application::GetFromGlobalSceneData(const std::string& dataName)
+	std::any& Application::GetFromGlobalSceneData(const StringID dataName)
 	{
 		return m_globalSceneData[dataName];
 	}
 
-	void Application::RemoveFromGlobalSceneData(const std::string& dataName)
+	void Application::RemoveFromGlobalSceneData(const StringID dataName)
 	{
 		m_globalSceneData.erase(dataName);
 	}
@@ -144,6 +159,13 @@ namespace stardust
 		Log::EngineDebug("Platform detected: \"{}\".", GetPlatformName());
 		Log::EngineInfo("ECS initialised.");
 
+		m_isHeadless = createInfo.headless.isEnabled;
+		m_headlessFrameLimit = createInfo.headless.frameLimit;
+
+		m_textureCache.SetMemoryBudget(createInfo.assetCache.textureMemoryBudget == 0u ? AssetCache<Texture>::NoMemoryBudget : createInfo.assetCache.textureMemoryBudget);
+		m_soundCache.SetMemoryBudget(createInfo.assetCache.soundMemoryBudget == 0u ? AssetCache<Sound>::NoMemoryBudget : createInfo.assetCache.soundMemoryBudget);
+		m_fontCache.SetMemoryBudget(createInfo.assetCache.fontMemoryBudget == 0u ? AssetCache<Font>::NoMemoryBudget : createInfo.assetCache.fontMemoryBudget);
+
 		static const std::vector<std::function<bool(Application* const, const CreateInfo&)>> initialisationFunctions{
 			&Application::InitialiseVFS,
 			&Application::InitialiseConfig,
@@ -170,7 +192,7 @@ namespace stardust
 		physics::World::SetPositionIterations(createInfo.physics.positionIterations);
 		Log::EngineInfo("Physics subsystem initialised.");
 
-		m_screenshotDirectory = createInfo.filepaths.screenshots;
+		m_screenshotWriter.Initialise(createInfo.filepaths.screenshots);
 		m_ticksCount = SDL_GetPerformanceCounter();
 
 		m_didInitialiseSuccessfully = true;
@@ -187,6 +209,7 @@ namespace stardust
 		}
 
 		vfs::AddToSearchPath({ createInfo.filesystem.assetsArchive, createInfo.filesystem.localesArchive });
+		m_asyncReader.Initialise();
 		Log::EngineInfo("Virtual filesystem initialised.");
 
 		return true;
@@ -211,7 +234,7 @@ namespace stardust
 	{
 		m_locale.Initialise("locales/engine", "locales/client");
 
-		if (m_locale.SetLocale(m_config["locale"]) == Status::Fail)
+		if (m_locale.SetLocale(m_config["locale"], m_asyncReader) == Status::Fail)
 		{
 			message_box::Show("Locale Error", "Failed to load initial locale files.", message_box::Type::Error);
 			Log::EngineError("Failed to load locale files for initial locale {}.", m_config["locale"]);
@@ -228,6 +251,13 @@ namespace stardust
 	{
 		if (!m_soundSystem.DidInitialiseSuccessfully())
 		{
+			if (m_isHeadless)
+			{
+				Log::EngineWarn("Sound system unavailable; continuing headless without audio.");
+
+				return true;
+			}
+
 			message_box::Show(m_locale["errors"]["titles"]["sound"], m_locale["errors"]["bodies"]["sound"], message_box::Type::Error);
 			Log::EngineCritical("Failed to initialise sound system.");
 
@@ -242,6 +272,12 @@ namespace stardust
 
 	bool Application::InitialiseSDL(const CreateInfo&)
 	{
+		if (m_isHeadless)
+		{
+			SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+			SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+		}
+
 		if (SDL_Init(SDL_INIT_EVERYTHING) != 0)
 		{
 			message_box::Show(m_locale["errors"]["titles"]["initialise"], m_locale["errors"]["bodies"]["initialise-sdl"], message_box::Type::Error);
@@ -259,9 +295,9 @@ namespace stardust
 	{
 		Window::SetMinimiseOnFullscreenFocusLoss(m_config["graphics"]["enable-fullscreen-minimise"]);
 
-		std::vector<Window::CreateFlag> windowCreateFlags{ Window::CreateFlag::AllowHighDPI, Window::CreateFlag::Shown };
+		std::vector<Window::CreateFlag> windowCreateFlags{ Window::CreateFlag::AllowHighDPI, m_isHeadless ? Window::CreateFlag::Hidden : Window::CreateFlag::Shown };
 
-		if (m_config["window"]["fullscreen"])
+		if (m_config["window"]["fullscreen"] && !m_isHeadless)
 		{
 			windowCreateFlags.push_back(Window::CreateFlag::HardFullscreen);
 
@@ -287,7 +323,11 @@ namespace stardust
 			return false;
 		}
 
-		m_window.SetIcon(createInfo.filepaths.windowIcon, m_locale);
+		if (!m_isHeadless)
+		{
+			m_window.SetIcon(createInfo.filepaths.windowIcon, m_locale);
+		}
+
 		Log::EngineInfo("Window created.");
 
 		return true;
@@ -295,11 +335,26 @@ namespace stardust
 
 	bool Application::InitialiseRenderer(const CreateInfo& createInfo)
 	{
-		m_renderer.Initialise(m_window, Renderer::CreateInfo{
-			.presentVSync = m_config["frame-rate"]["enable-vsync"],
+		const Renderer::CreateInfo rendererCreateInfo{
+			.presentVSync = m_config["frame-rate"]["enable-vsync"] && !m_isHeadless,
 			.allowRenderToTexture = createInfo.requireRenderToTexture,
 			.blendMode = Renderer::BlendMode::Alpha,
-							  });
+			.drawMode = createInfo.useDeferredRendering ? Renderer::DrawMode::Deferred : Renderer::DrawMode::Immediate,
+		};
+
+		if (m_isHeadless)
+		{
+			m_headlessSurface.Initialise(createInfo.rendererLogicalSize.x, createInfo.rendererLogicalSize.y, 4u);
+
+			if (m_headlessSurface.IsValid())
+			{
+				m_renderer.Initialise(m_headlessSurface, rendererCreateInfo);
+			}
+		}
+		else
+		{
+			m_renderer.Initialise(m_window, rendererCreateInfo);
+		}
 
 		if (!m_renderer.IsValid())
 		{
@@ -310,7 +365,15 @@ namespace stardust
 		}
 
 		m_renderer.SetLogicalSize(createInfo.rendererLogicalSize);
-		Log::EngineInfo("Renderer created {} VSync.", m_config["frame-rate"]["enable-vsync"] ? "with" : "without");
+		Log::EngineInfo("Renderer created {} VSync{}.", rendererCreateInfo.presentVSync ? "with" : "without", m_isHeadless ? " (headless)" : "");
+
+		if (createInfo.useDirtyRectRendering)
+		{
+			SetDirtyRectRendering(true);
+		}
+
+		m_textureLoader.Initialise(m_renderer, m_asyncReader);
+		m_commandRecorder.Initialise();
 
 		return true;
 	}
@@ -445,6 +508,7 @@ namespace stardust
 		{
 		case SDL_WINDOWEVENT_SIZE_CHANGED:
 			m_window.ProcessResize(glm::uvec2{ windowEvent.data1, windowEvent.data2 });
+			m_renderer.MarkFrameDirty();
 			m_sceneManager.CurrentScene()->OnWindowResized(glm::uvec2{ windowEvent.data1, windowEvent.data2 });
 
 			break;
@@ -511,11 +575,127 @@ namespace stardust
 		m_sceneManager.CurrentScene()->LateUpdate(m_deltaTime);
 	}
 
-	void Application::Render() const
+	void Application::Render()
 	{
-		m_renderer.Clear(colours::Black);
-		m_sceneManager.CurrentScene()->Render(m_renderer);
+		const std::uint64_t renderStartTicks = SDL_GetPerformanceCounter();
+
+		m_renderer.ResetStatistics();
+
+		if (m_isDirtyRectRenderingEnabled)
+		{
+			RenderDirtyRegions();
+		}
+		else
+		{
+			m_renderer.Clear(colours::Black);
+			m_sceneManager.CurrentScene()->Render(m_renderer);
+		}
+
+		m_renderer.FlushDeferredDraws();
+
+		if (m_screenshotWriter.IsCapturePending())
+		{
+			m_screenshotWriter.CapturePendingFrame(m_renderer);
+		}
+
 		m_renderer.Present();
+
+		m_lastRenderTime = static_cast<float>(SDL_GetPerformanceCounter() - renderStartTicks) / static_cast<float>(SDL_GetPerformanceFrequency());
+	}
+
+	void Application::RenderDirtyRegions()
+	{
+		const glm::uvec2 frameSize = GetFrameSize();
+
+		if (m_frameTexture.GetSize() != frameSize && !CreateFrameTexture())
+		{
+			Log::EngineWarn("Disabling dirty rectangle rendering.");
+			m_isDirtyRectRenderingEnabled = false;
+
+			m_renderer.Clear(colours::Black);
+			m_sceneManager.CurrentScene()->Render(m_renderer);
+
+			return;
+		}
+
+		if (m_renderer.IsFrameDirty())
+		{
+			m_renderer.SetCurrentRenderTarget(m_frameTexture);
+
+			if (m_renderer.IsFrameFullyDirty())
+			{
+				m_renderer.Clear(colours::Black);
+				m_sceneManager.CurrentScene()->Render(m_renderer);
+			}
+			else
+			{
+				const rect::Rect dirtyRegion = m_renderer.GetDirtyFrameRegion().value();
+				const Renderer::DrawMode previousDrawMode = m_renderer.GetDrawMode();
+				const Renderer::BlendMode previousBlendMode = m_renderer.GetBlendMode();
+
+				m_renderer.SetClipRect(dirtyRegion);
+
+				m_renderer.SetDrawMode(Renderer::DrawMode::Immediate);
+				m_renderer.SetBlendMode(Renderer::BlendMode::None);
+				m_renderer.DrawRect(dirtyRegion, colours::Black);
+				m_renderer.SetBlendMode(previousBlendMode);
+				m_renderer.SetDrawMode(previousDrawMode);
+
+				m_sceneManager.CurrentScene()->Render(m_renderer);
+				m_renderer.RemoveClipRect();
+			}
+
+			m_renderer.ResetRenderTarget();
+			m_renderer.ResetFrameDirtyState();
+		}
+
+		m_renderer.Clear(colours::Black);
+		m_renderer.DrawTexture(m_frameTexture, std::nullopt, static_cast<glm::vec2>(frameSize) / 2.0f, glm::vec2{ 1.0f, 1.0f });
+	}
+
+	[[nodiscard]] bool Application::CreateFrameTexture()
+	{
+		if (!m_renderer.CanRenderToTexture())
+		{
+			return false;
+		}
+
+		m_frameTexture.Initialise(m_renderer, SDL_PIXELFORMAT_RGBA8888, Texture::AccessType::Target, GetFrameSize());
+
+		if (!m_frameTexture.IsValid())
+		{
+			Log::EngineError("Failed to create dirty rectangle frame texture: {}.", SDL_GetError());
+
+			return false;
+		}
+
+		m_frameTexture.SetBlendMode(Renderer::BlendMode::None);
+		m_renderer.MarkFrameDirty();
+
+		return true;
+	}
+
+	[[nodiscard]] glm::uvec2 Application::GetFrameSize() const
+	{
+		const glm::uvec2 logicalSize = m_renderer.GetLogicalSize();
+
+		return logicalSize.x != 0u && logicalSize.y != 0u ? logicalSize : m_renderer.GetOutputSize();
+	}
+
+	void Application::ProcessCompletedScreenshots()
+	{
+		for (const auto& completedCapture : m_screenshotWriter.GetCompletedCaptures())
+		{
+			if (completedCapture.wasSuccessful)
+			{
+				Log::EngineTrace("Screenshot captured at {}.", completedCapture.filepath);
+			}
+			else
+			{
+				message_box::Show(m_locale["warnings"]["titles"]["screenshot"], m_locale["warnings"]["bodies"]["screenshot"], message_box::Type::Warning);
+				Log::EngineWarn("Failed to take screenshot.");
+			}
+		}
 	}
 
 	void Application::CalculateDeltaTime()
@@ -550,8 +730,9 @@ namespace stardust
 		{
 			Log::EngineTrace("Scene \"{}\" finished.", m_sceneManager.CurrentScene()->GetName());
 			m_sceneManager.CurrentScene()->OnUnload();
-			m_sceneManager.PopScene();
+			std::unique_ptr<Scene> finishedScene = m_sceneManager.ReleaseCurrentScene();
 			m_entityRegistry.clear();
+			m_renderer.MarkFrameDirty();
 			m_soundSystem.GetListener().Reset();
 
 			if (!m_sceneManager.IsEmpty())
@@ -568,6 +749,7 @@ namespace stardust
 				}
 			}
 
+			finishedScene = nullptr;
 			m_isCurrentSceneFinished = false;
 		}
 
@@ -17,13 +17,23 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 
+#include "../assets/AssetCache.h"
 #include "../audio/SoundSystem.h"
+#include "../audio/sounds/Sounds.h"
 #include "../audio/volume/VolumeManager.h"
 #include "../config/Config.h"
+#include "../graphics/renderer/command_buffer/CommandRecorder.h"
 #include "../graphics/renderer/Renderer.h"
+#include "../graphics/screenshot/ScreenshotWriter.h"
+#include "../graphics/surface/PixelSurface.h"
+#include "../graphics/texture/Texture.h"
+#include "../graphics/texture/texture_loader/TextureLoader.h"
 #include "../graphics/window/Window.h"
 #include "../locale/Locale.h"
 #include "../scene/SceneManager.h"
+#include "../text/font/Font.h"
+#include "../utility/string_id/StringID.h"
+#include "../vfs/AsyncReader.h"
 
 namespace stardust
 {
@@ -54,6 +64,19 @@ namespace stardust
 			std::uint32_t positionIterations;
 		};
 
+		struct AssetCacheInfo
+		{
+			std::size_t textureMemoryBudget;
+			std::size_t soundMemoryBudget;
+			std::size_t fontMemoryBudget;
+		};
+
+		struct HeadlessInfo
+		{
+			bool isEnabled;
+			std::uint64_t frameLimit;
+		};
+
 		struct CreateInfo
 		{
 			std::string_view title;
@@ -63,7 +86,12 @@ namespace stardust
 			PhysicsInfo physics;
 
 			bool requireRenderToTexture;
+			bool useDeferredRendering;
+			bool useDirtyRectRendering;
 			glm::uvec2 rendererLogicalSize;
+
+			AssetCacheInfo assetCache;
+			HeadlessInfo headless;
 		};
 
 	private:
@@ -76,6 +104,13 @@ namespace stardust
 		Renderer m_renderer;
 		bool m_hasWindowFocus = true;
 
+		bool m_isDirtyRectRenderingEnabled = false;
+		Texture m_frameTexture;
+
+		bool m_isHeadless = false;
+		PixelSurface m_headlessSurface;
+		std::uint64_t m_headlessFrameLimit = 0u;
+
 		std::atomic<bool> m_isRunning = true;
 
 		float m_fixedTimestep = 0.0f;
@@ -83,6 +118,9 @@ namespace stardust
 		std::uint64_t m_ticksCount = 0u;
 		float m_elapsedTime = 0.0f;
 
+		std::uint64_t m_frameCount = 0u;
+		float m_lastRenderTime = 0.0f;
+
 		SceneManager m_sceneManager;
 		bool m_isCurrentSceneFinished = false;
 
@@ -90,9 +128,16 @@ namespace stardust
 		SoundSystem m_soundSystem;
 		VolumeManager m_volumeManager;
 
-		std::string m_screenshotDirectory;
+		AssetCache<Texture> m_textureCache;
+		AssetCache<Sound> m_soundCache;
+		AssetCache<Font> m_fontCache;
+
+		ScreenshotWriter m_screenshotWriter;
+		TextureLoader m_textureLoader;
+		vfs::AsyncReader m_asyncReader;
+		CommandRecorder m_commandRecorder;
 
-		std::unordered_map<std::string, std::any> m_globalSceneData{ };
+		std::unordered_map<StringID, std::any> m_globalSceneData{ };
 
 	public:
 		Application(const CreateInfo& createInfo);
@@ -104,6 +149,10 @@ namespace stardust
 		void ForceQuit() noexcept;
 
 		void TakeScreenshot();
+		void TakeScreenshotBurst(const unsigned int frameCount);
+
+		inline bool IsDirtyRectRenderingEnabled() const noexcept { return m_isDirtyRectRenderingEnabled; }
+		void SetDirtyRectRendering(const bool enableDirtyRectRendering);
 
 		inline bool DidInitialiseSuccessfully() const noexcept { return m_didInitialiseSuccessfully; }
 
@@ -113,27 +162,39 @@ namespace stardust
 		inline Window& GetWindow() noexcept { return m_window; }
 		inline const Renderer& GetRenderer() const noexcept { return m_renderer; }
 		inline SceneManager& GetSceneManager() noexcept { return m_sceneManager; }
+		inline TextureLoader& GetTextureLoader() noexcept { return m_textureLoader; }
+		inline vfs::AsyncReader& GetAsyncReader() noexcept { return m_asyncReader; }
+		inline CommandRecorder& GetCommandRecorder() noexcept { return m_commandRecorder; }
 
 		inline entt::registry& GetEntityRegistry() noexcept { return m_entityRegistry; }
 		inline SoundSystem& GetSoundSystem() noexcept { return m_soundSystem; }
 		inline VolumeManager& GetVolumeManager() noexcept { return m_volumeManager; }
 
+		inline AssetCache<Texture>& GetTextureCache() noexcept { return m_textureCache; }
+		inline AssetCache<Sound>& GetSoundCache() noexcept { return m_soundCache; }
+		inline AssetCache<Font>& GetFontCache() noexcept { return m_fontCache; }
+
 		[[nodiscard]] std::string GetPlatformName() const;
 
 		inline bool IsRunning() const noexcept { return m_isRunning; }
 		inline float GetElapsedTime() const noexcept { return m_elapsedTime; }
 		inline bool HasWindowFocus() const noexcept { return m_hasWindowFocus; }
 
+		inline bool IsHeadless() const noexcept { return m_isHeadless; }
+		inline const PixelSurface& GetHeadlessSurface() const noexcept { return m_headlessSurface; }
+		inline std::uint64_t GetFrameCount() const noexcept { return m_frameCount; }
+		inline float GetLastRenderTime() const noexcept { return m_lastRenderTime; }
+
 		template <typename T>
-		void SetGlobalSceneData(const std::string& dataName, const T& data)
+		void SetGlobalSceneData(const std::string_view& dataName, const T& data)
 		{
-			m_globalSceneData[dataName] = data;
+			m_globalSceneData[StringID::Intern(dataName)] = data;
 		}
 
-		std::any& GetFromGlobalSceneData(const std::string& dataName);
-		void RemoveFromGlobalSceneData(const std::string& dataName);
+		std::any& GetFromGlobalSceneData(const StringID dataName);
+		void RemoveFromGlobalSceneData(const StringID dataName);
 
-		inline std::unordered_map<std::string, std::any>& GetGlobalSceneData() noexcept { return m_globalSceneData; }
+		inline std::unordered_map<StringID, std::any>& GetGlobalSceneData() noexcept { return m_globalSceneData; }
 
 	private:
 		void Initialise(const CreateInfo& createInfo);
@@ -154,7 +215,11 @@ namespace stardust
 		void ProcessInput();
 		void Update();
 		void LateUpdate();
-		void Render() const;
+		void Render();
+		void RenderDirtyRegions();
+		[[nodiscard]] bool CreateFrameTexture();
+		[[nodiscard]] glm::uvec2 GetFrameSize() const;
+		void ProcessCompletedScreenshots();
 
 		void CalculateDeltaTime();
 		void UpdateSceneQueue();
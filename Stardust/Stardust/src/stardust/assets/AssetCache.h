@@ -0,0 +1,402 @@
+#pragma once
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include "../utility/interfaces/INoncopyable.h"
+#include "../utility/interfaces/INonmovable.h"
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "../debug/logging/Log.h"
+#include "../utility/string_id/StringID.h"
+
+namespace stardust
+{
+	template <typename T>
+	concept MemoryAccountable = requires(const T& asset)
+	{
+		{ asset.GetMemoryUsage() } -> std::convertible_to<std::size_t>;
+	};
+
+	template <typename T>
+	class AssetCache;
+
+	template <typename T>
+	class AssetHandle
+	{
+	private:
+		AssetCache<T>* m_cache = nullptr;
+		StringID m_name;
+		T* m_asset = nullptr;
+
+	public:
+		AssetHandle() = default;
+
+		AssetHandle(const AssetHandle& other)
+			: m_cache(other.m_cache), m_name(other.m_name), m_asset(other.m_asset)
+		{
+			if (m_cache != nullptr)
+			{
+				m_cache->Retain(m_name);
+			}
+		}
+
+		AssetHandle& operator =(const AssetHandle& other)
+		{
+			if (this != &other)
+			{
+				AssetHandle copy(other);
+				std::swap(m_cache, copy.m_cache);
+				std::swap(m_name, copy.m_name);
+				std::swap(m_asset, copy.m_asset);
+			}
+
+			return *this;
+		}
+
+		AssetHandle(AssetHandle&& other) noexcept
+			: m_cache(nullptr), m_name(), m_asset(nullptr)
+		{
+			std::swap(m_cache, other.m_cache);
+			std::swap(m_name, other.m_name);
+			std::swap(m_asset, other.m_asset);
+		}
+
+		AssetHandle& operator =(AssetHandle&& other) noexcept
+		{
+			Reset();
+
+			m_cache = std::exchange(other.m_cache, nullptr);
+			m_name = std::exchange(other.m_name, StringID());
+			m_asset = std::exchange(other.m_asset, nullptr);
+
+			return *this;
+		}
+
+		~AssetHandle() noexcept
+		{
+			Reset();
+		}
+
+		void Reset() noexcept
+		{
+			if (m_cache != nullptr)
+			{
+				m_cache->Release(m_name);
+
+				m_cache = nullptr;
+				m_name = StringID();
+				m_asset = nullptr;
+			}
+		}
+
+		inline bool IsValid() const noexcept { return m_asset != nullptr; }
+		inline explicit operator bool() const noexcept { return IsValid(); }
+
+		inline StringID GetName() const noexcept { return m_name; }
+
+		inline T& Get() const noexcept { return *m_asset; }
+		inline T& operator *() const noexcept { return Get(); }
+		inline T* operator ->() const noexcept { return m_asset; }
+
+	private:
+		friend class AssetCache<T>;
+
+		AssetHandle(AssetCache<T>& cache, const StringID name, T& asset)
+			: m_cache(&cache), m_name(name), m_asset(&asset)
+		{ }
+	};
+
+	template <typename T>
+	class AssetCache
+		: private INoncopyable, private INonmovable
+	{
+	public:
+		using Loader = std::function<std::unique_ptr<T>()>;
+
+		static constexpr std::size_t NoMemoryBudget = std::numeric_limits<std::size_t>::max();
+
+	private:
+		struct Entry
+		{
+			Loader loader;
+			std::unique_ptr<T> asset;
+
+			std::size_t memoryUsage;
+			unsigned int referenceCount;
+			std::list<StringID>::iterator recentUsePosition;
+		};
+
+		template <typename Arg>
+		using StoredArgument = std::conditional_t<
+			std::is_copy_constructible_v<std::decay_t<Arg>>,
+			std::decay_t<Arg>,
+			std::reference_wrapper<std::remove_reference_t<Arg>>
+		>;
+
+		std::unordered_map<StringID, Entry> m_entries{ };
+		std::list<StringID> m_recentlyUsedAssets{ };
+
+		std::size_t m_memoryBudget = NoMemoryBudget;
+		std::size_t m_memoryUsage = 0u;
+
+		unsigned int m_loadCount = 0u;
+		unsigned int m_evictionCount = 0u;
+
+	public:
+		explicit AssetCache(const std::size_t memoryBudget = NoMemoryBudget)
+			: m_memoryBudget(memoryBudget)
+		{ }
+
+		~AssetCache() noexcept
+		{
+			Clear();
+		}
+
+		void Register(const std::string_view& name, const Loader& loader)
+		{
+			const StringID assetName = StringID::Intern(name);
+
+			if (const auto entryLocation = m_entries.find(assetName);
+				entryLocation != std::end(m_entries))
+			{
+				entryLocation->second.loader = loader;
+
+				return;
+			}
+
+			m_entries.emplace(assetName, Entry{
+				.loader = loader,
+				.asset = nullptr,
+				.memoryUsage = 0u,
+				.referenceCount = 0u,
+				.recentUsePosition = std::end(m_recentlyUsedAssets),
+			});
+		}
+
+		template <typename... Args, typename = std::enable_if_t<std::is_constructible_v<T, Args...>>>
+		void Add(const std::string_view& name, Args&&... args)
+		{
+			Register(name, [storedArgs = std::tuple<StoredArgument<Args>...>(std::forward<Args>(args)...)]()
+			{
+				return std::apply([](const auto&... storedArg) { return std::make_unique<T>(storedArg...); }, storedArgs);
+			});
+		}
+
+		[[nodiscard]] AssetHandle<T> Acquire(const StringID name)
+		{
+			const auto entryLocation = m_entries.find(name);
+
+			if (entryLocation == std::end(m_entries))
+			{
+				return AssetHandle<T>();
+			}
+
+			Entry& entry = entryLocation->second;
+
+			if (entry.asset == nullptr && !Load(name, entry))
+			{
+				return AssetHandle<T>();
+			}
+
+			++entry.referenceCount;
+			MarkAsRecentlyUsed(entry);
+
+			return AssetHandle<T>(*this, name, *entry.asset);
+		}
+
+		void Remove(const StringID name)
+		{
+			const auto entryLocation = m_entries.find(name);
+
+			if (entryLocation == std::end(m_entries))
+			{
+				return;
+			}
+
+			if (entryLocation->second.referenceCount > 0u)
+			{
+				Log::EngineWarn("Cannot remove asset {} from the cache while it is still referenced.", StringID::GetString(name));
+
+				return;
+			}
+
+			Unload(entryLocation->second);
+			m_entries.erase(entryLocation);
+		}
+
+		void Clear()
+		{
+			std::size_t referencedAssetCount = 0u;
+
+			for (auto entryLocation = std::begin(m_entries); entryLocation != std::end(m_entries); )
+			{
+				if (entryLocation->second.referenceCount > 0u)
+				{
+					++referencedAssetCount;
+					++entryLocation;
+				}
+				else
+				{
+					Unload(entryLocation->second);
+					entryLocation = m_entries.erase(entryLocation);
+				}
+			}
+
+			if (referencedAssetCount > 0u)
+			{
+				Log::EngineWarn("Cannot clear {} asset(s) from the cache while they are still referenced.", referencedAssetCount);
+			}
+		}
+
+		void Trim()
+		{
+			EvictUntilWithinBudget(0u);
+		}
+
+		inline bool Contains(const StringID name) const { return m_entries.contains(name); }
+
+		[[nodiscard]] bool IsResident(const StringID name) const
+		{
+			const auto entryLocation = m_entries.find(name);
+
+			return entryLocation != std::cend(m_entries) && entryLocation->second.asset != nullptr;
+		}
+
+		inline std::size_t GetMemoryBudget() const noexcept { return m_memoryBudget; }
+
+		void SetMemoryBudget(const std::size_t memoryBudget)
+		{
+			m_memoryBudget = memoryBudget;
+			EvictUntilWithinBudget(m_memoryBudget);
+		}
+
+		inline std::size_t GetMemoryUsage() const noexcept { return m_memoryUsage; }
+		inline std::size_t GetAssetCount() const noexcept { return m_entries.size(); }
+		inline std::size_t GetResidentAssetCount() const noexcept { return m_recentlyUsedAssets.size(); }
+
+		inline unsigned int GetLoadCount() const noexcept { return m_loadCount; }
+		inline unsigned int GetEvictionCount() const noexcept { return m_evictionCount; }
+
+	private:
+		friend class AssetHandle<T>;
+
+		[[nodiscard]] static std::size_t GetAssetMemoryUsage(const T& asset)
+		{
+			if constexpr (MemoryAccountable<T>)
+			{
+				return static_cast<std::size_t>(asset.GetMemoryUsage());
+			}
+			else
+			{
+				return sizeof(T);
+			}
+		}
+
+		[[nodiscard]] bool Load(const StringID name, Entry& entry)
+		{
+			entry.asset = entry.loader();
+
+			if constexpr (requires(const T& asset) { { asset.IsValid() } -> std::convertible_to<bool>; })
+			{
+				if (entry.asset != nullptr && !entry.asset->IsValid())
+				{
+					entry.asset = nullptr;
+				}
+			}
+
+			if (entry.asset == nullptr)
+			{
+				Log::EngineError("Failed to load asset {} into the cache.", StringID::GetString(name));
+
+				return false;
+			}
+
+			entry.memoryUsage = GetAssetMemoryUsage(*entry.asset);
+			EvictUntilWithinBudget(m_memoryBudget > entry.memoryUsage ? m_memoryBudget - entry.memoryUsage : 0u);
+
+			m_memoryUsage += entry.memoryUsage;
+			entry.recentUsePosition = m_recentlyUsedAssets.insert(std::begin(m_recentlyUsedAssets), name);
+			++m_loadCount;
+
+			return true;
+		}
+
+		void Unload(Entry& entry)
+		{
+			if (entry.asset == nullptr)
+			{
+				return;
+			}
+
+			m_recentlyUsedAssets.erase(entry.recentUsePosition);
+			entry.recentUsePosition = std::end(m_recentlyUsedAssets);
+
+			m_memoryUsage -= entry.memoryUsage;
+			entry.memoryUsage = 0u;
+			entry.asset = nullptr;
+		}
+
+		void MarkAsRecentlyUsed(Entry& entry)
+		{
+			m_recentlyUsedAssets.splice(std::begin(m_recentlyUsedAssets), m_recentlyUsedAssets, entry.recentUsePosition);
+		}
+
+		void EvictUntilWithinBudget(const std::size_t memoryBudget)
+		{
+			auto assetIterator = std::end(m_recentlyUsedAssets);
+
+			while (m_memoryUsage > memoryBudget && assetIterator != std::begin(m_recentlyUsedAssets))
+			{
+				--assetIterator;
+				Entry& entry = m_entries.at(*assetIterator);
+
+				if (entry.referenceCount == 0u)
+				{
+					auto nextAssetIterator = std::next(assetIterator);
+					Unload(entry);
+					assetIterator = nextAssetIterator;
+
+					++m_evictionCount;
+				}
+			}
+		}
+
+		void Retain(const StringID name)
+		{
+			++m_entries.at(name).referenceCount;
+		}
+
+		void Release(const StringID name) noexcept
+		{
+			const auto entryLocation = m_entries.find(name);
+
+			if (entryLocation == std::end(m_entries) || entryLocation->second.referenceCount == 0u)
+			{
+				return;
+			}
+
+			Entry& entry = entryLocation->second;
+			--entry.referenceCount;
+
+			if (entry.referenceCount == 0u)
+			{
+				MarkAsRecentlyUsed(entry);
+				EvictUntilWithinBudget(m_memoryBudget);
+			}
+		}
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "AssetSet.h"
+
+#include "../application/Application.h"
+
+namespace stardust
+{
+	AssetSet::AssetSet(Application& application)
+		: m_application(application)
+	{ }
+
+	[[nodiscard]] Status AssetSet::AddTexture(const std::string_view& name, const std::string_view& filepath)
+	{
+		AssetCache<Texture>& textureCache = m_application.GetTextureCache();
+		const std::string cacheKey(filepath);
+
+		if (!textureCache.Contains(StringID(cacheKey)))
+		{
+			textureCache.Add(cacheKey, m_application.GetRenderer(), cacheKey);
+		}
+
+		return Store(m_textures, name, textureCache.Acquire(StringID(cacheKey)));
+	}
+
+	[[nodiscard]] Status AssetSet::AddSound(const std::string_view& name, const std::string_view& filepath)
+	{
+		AssetCache<Sound>& soundCache = m_application.GetSoundCache();
+		const std::string cacheKey(filepath);
+
+		if (!soundCache.Contains(StringID(cacheKey)))
+		{
+			soundCache.Add(cacheKey, cacheKey);
+		}
+
+		return Store(m_sounds, name, soundCache.Acquire(StringID(cacheKey)));
+	}
+
+	[[nodiscard]] Status AssetSet::AddFont(const std::string_view& name, const std::string_view& filepath, const unsigned int pointSize)
+	{
+		AssetCache<Font>& fontCache = m_application.GetFontCache();
+		const std::string cacheKey = std::string(filepath) + "#" + std::to_string(pointSize);
+
+		if (!fontCache.Contains(StringID(cacheKey)))
+		{
+			fontCache.Add(cacheKey, std::string(filepath), pointSize);
+		}
+
+		return Store(m_fonts, name, fontCache.Acquire(StringID(cacheKey)));
+	}
+
+	void AssetSet::Clear() noexcept
+	{
+		m_textures.clear();
+		m_sounds.clear();
+		m_fonts.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+#ifndef ASSET_SET_H
+#define ASSET_SET_H
+
+#include "../utility/interfaces/INoncopyable.h"
+#include "../utility/interfaces/INonmovable.h"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "../audio/sounds/Sounds.h"
+#include "../graphics/texture/Texture.h"
+#include "../text/font/Font.h"
+#include "../utility/enums/Status.h"
+#include "../utility/string_id/StringID.h"
+#include "AssetCache.h"
+
+namespace stardust
+{
+	class AssetSet
+		: private INoncopyable, private INonmovable
+	{
+	private:
+		class Application& m_application;
+
+		std::unordered_map<StringID, AssetHandle<Texture>> m_textures{ };
+		std::unordered_map<StringID, AssetHandle<Sound>> m_sounds{ };
+		std::unordered_map<StringID, AssetHandle<Font>> m_fonts{ };
+
+	public:
+		explicit AssetSet(class Application& application);
+		~AssetSet() noexcept = default;
+
+		[[nodiscard]] Status AddTexture(const std::string_view& name, const std::string_view& filepath);
+		[[nodiscard]] Status AddSound(const std::string_view& name, const std::string_view& filepath);
+		[[nodiscard]] Status AddFont(const std::string_view& name, const std::string_view& filepath, const unsigned int pointSize);
+
+		void Clear() noexcept;
+
+		inline bool HasTexture(const StringID name) const { return m_textures.contains(name); }
+		inline bool HasSound(const StringID name) const { return m_sounds.contains(name); }
+		inline bool HasFont(const StringID name) const { return m_fonts.contains(name); }
+
+		inline Texture& GetTexture(const StringID name) const { return m_textures.at(name).Get(); }
+		inline Sound& GetSound(const StringID name) const { return m_sounds.at(name).Get(); }
+		inline Font& GetFont(const StringID name) const { return m_fonts.at(name).Get(); }
+
+	private:
+		template <typename T>
+		[[nodiscard]] static Status Store(std::unordered_map<StringID, AssetHandle<T>>& handles, const std::string_view& name, AssetHandle<T>&& handle)
+		{
+			if (!handle.IsValid())
+			{
+				return Status::Fail;
+			}
+
+			handles[StringID::Intern(name)] = std::move(handle);
+
+			return Status::Success;
+		}
+	};
+}
+
+#endif
\ No newline at end of file
@@ -7,8 +7,8 @@
 
 #include <concepts>
 #include <cstddef>
+#include <memory>
 #include <string_view>
-#include <vector>
 
 #include <soloud/soloud.h>
 #undef min
@@ -16,6 +16,7 @@
 
 #include "../../vfs/VFS.h"
 #include "SoundEnums.h"
+#include "SoundFile.h"
 
 namespace stardust
 {
@@ -24,10 +25,15 @@ namespace stardust
 		: private INoncopyable, private INonmovable
 	{
 	private:
+		static constexpr bool s_IsFullyDecoded = requires(const T& handle) { handle.mData; handle.mSampleCount; };
+
+		vfs::FileView m_soundFileView;
+		std::unique_ptr<SoundFile> m_soundFile = nullptr;
 		T m_handle;
 		bool m_isValid = false;
 
 		double m_length = 0.0f;
+		std::size_t m_memoryUsage = 0u;
 		bool m_isSingleInstance = false;
 
 		float m_volume = 1.0f;
@@ -49,25 +55,35 @@ namespace stardust
 	public:
 		SoundBase(const std::string_view& filepath)
 		{
-			const std::vector<std::byte> rawSoundData = vfs::ReadFileData(filepath);
-
-			const SoLoud::result loadStatus = m_handle.loadMem(
-				reinterpret_cast<const unsigned char*>(rawSoundData.data()),
-				static_cast<unsigned int>(rawSoundData.size()),
-				true,
-				false
-			);
-			m_isValid = loadStatus == 0u;
-
-			if (m_isValid)
+			if constexpr (s_IsFullyDecoded)
 			{
-				m_length = m_handle.getLength();
+				LoadFromFileView(vfs::ReadFileView(filepath));
+			}
+			else
+			{
+				m_soundFileView = vfs::MapFileView(filepath);
+
+				if (m_soundFileView.IsValid())
+				{
+					LoadFromFileView(m_soundFileView);
+				}
+				else
+				{
+					LoadFromSoundFile(filepath);
+				}
 			}
 		}
 
+		explicit SoundBase(const vfs::FileView& soundFileView)
+			requires s_IsFullyDecoded
+		{
+			LoadFromFileView(soundFileView);
+		}
+
 		~SoundBase() noexcept = default;
 
 		inline bool IsValid() const noexcept { return m_isValid; }
+		inline std::size_t GetMemoryUsage() const noexcept { return m_memoryUsage; }
 
 		void StopAll()
 		{
@@ -79,6 +95,11 @@ namespace stardust
 
 		void SetSingleInstance(const bool isSingleInstance)
 		{
+			if (m_soundFile != nullptr && !isSingleInstance)
+			{
+				return;
+			}
+
 			m_handle.setSingleInstance(isSingleInstance);
 			m_isSingleInstance = isSingleInstance;
 		}
@@ -191,6 +212,43 @@ namespace stardust
 
 		inline T& GetRawHandle() noexcept { return m_handle; }
 		inline const T& GetRawHandle() const noexcept { return m_handle; }
+
+	private:
+		void LoadFromSoundFile(const std::string_view& filepath)
+		{
+			m_soundFile = std::make_unique<SoundFile>(filepath);
+			m_isValid = m_soundFile->IsValid() && m_handle.loadFile(m_soundFile.get()) == 0u;
+
+			if (m_isValid)
+			{
+				m_length = m_handle.getLength();
+				m_memoryUsage = m_soundFile->GetMemoryUsage();
+
+				m_handle.setSingleInstance(true);
+				m_isSingleInstance = true;
+			}
+		}
+
+		void LoadFromFileView(const vfs::FileView& soundFileView)
+		{
+			const SoLoud::result loadStatus = m_handle.loadMem(
+				reinterpret_cast<const unsigned char*>(soundFileView.GetData()),
+				static_cast<unsigned int>(soundFileView.GetSize()),
+				false,
+				false
+			);
+			m_isValid = loadStatus == 0u;
+
+			if (m_isValid)
+			{
+				m_length = m_handle.getLength();
+
+				if constexpr (s_IsFullyDecoded)
+				{
+					m_memoryUsage = static_cast<std::size_t>(m_handle.mSampleCount) * static_cast<std::size_t>(m_handle.mChannels) * sizeof(float);
+				}
+			}
+		}
 	};
 }
 
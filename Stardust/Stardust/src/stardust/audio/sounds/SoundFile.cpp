@@ -0,0 +1,40 @@
+#include "SoundFile.h"
+
+#include <cstdint>
+
+#include "../../debug/logging/Log.h"
+
+namespace stardust
+{
+	SoundFile::SoundFile(const std::string_view& filepath, const std::size_t bufferSize)
+		: m_stream(filepath, bufferSize)
+	{ }
+
+	int SoundFile::eof()
+	{
+		return m_stream.IsEndOfFile() ? 1 : 0;
+	}
+
+	unsigned int SoundFile::read(unsigned char* aDst, unsigned int aBytes)
+	{
+		return static_cast<unsigned int>(m_stream.Read(aDst, aBytes));
+	}
+
+	unsigned int SoundFile::length()
+	{
+		return static_cast<unsigned int>(m_stream.GetLength());
+	}
+
+	void SoundFile::seek(int aOffset)
+	{
+		if (m_stream.Seek(static_cast<std::int64_t>(aOffset), vfs::Stream::SeekOrigin::Begin) == Status::Fail)
+		{
+			Log::EngineWarn("Failed to seek sound file to offset {}.", aOffset);
+		}
+	}
+
+	unsigned int SoundFile::pos()
+	{
+		return static_cast<unsigned int>(m_stream.Tell());
+	}
+}
\ No newline at end of file
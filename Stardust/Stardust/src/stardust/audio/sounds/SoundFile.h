@@ -0,0 +1,40 @@
+#pragma once
+#ifndef SOUND_FILE_H
+#define SOUND_FILE_H
+
+#include "../../utility/interfaces/INoncopyable.h"
+#include "../../utility/interfaces/INonmovable.h"
+
+#include <cstddef>
+#include <string_view>
+
+#include <soloud/soloud_file.h>
+#undef min
+#undef max
+
+#include "../../vfs/Stream.h"
+
+namespace stardust
+{
+	class SoundFile final
+		: public SoLoud::File, private INoncopyable, private INonmovable
+	{
+	private:
+		vfs::Stream m_stream;
+
+	public:
+		explicit SoundFile(const std::string_view& filepath, const std::size_t bufferSize = vfs::Stream::DefaultBufferSize);
+		virtual ~SoundFile() noexcept override = default;
+
+		virtual int eof() override;
+		virtual unsigned int read(unsigned char* aDst, unsigned int aBytes) override;
+		virtual unsigned int length() override;
+		virtual void seek(int aOffset) override;
+		virtual unsigned int pos() override;
+
+		inline bool IsValid() const noexcept { return m_stream.IsValid(); }
+		inline std::size_t GetMemoryUsage() const noexcept { return m_stream.GetBufferSize(); }
+	};
+}
+
+#endif
\ No newline at end of file
@@ -1,40 +1,33 @@
 #include "VolumeManager.h"
 
-void stardust::VolumeManager::AddVolume(const std::string& volumeName, const float value)
+void stardust::VolumeManager::AddVolume(const std::string_view& volumeName, const float value)
 {
-	if (!m_volumes.contains(volumeName))
-	{
-		m_volumes.insert({ volumeName, value });
-	}
-	else
-	{
-		m_volumes[volumeName] = value;
-	}
+	m_volumes[StringID::Intern(volumeName)] = value;
 }
 
-void stardust::VolumeManager::SetVolume(const std::string& volumeName, const float value)
+void stardust::VolumeManager::SetVolume(const StringID volumeName, const float value)
 {
 	m_volumes[volumeName] = value;
 }
 
-[[nodiscard]] float stardust::VolumeManager::GetVolume(const std::string& volumeName) const
+[[nodiscard]] float stardust::VolumeManager::GetVolume(const StringID volumeName) const
 {
 	return m_volumes.at(volumeName);
 }
 
-void stardust::VolumeManager::ResetVolume(const std::string& volumeName)
+void stardust::VolumeManager::ResetVolume(const StringID volumeName)
 {
 	m_volumes[volumeName] = 1.0f;
 }
 
-[[nodiscard]] bool stardust::VolumeManager::DoesVolumeExist(const std::string& volumeName) const
+[[nodiscard]] bool stardust::VolumeManager::DoesVolumeExist(const StringID volumeName) const
 {
 	return m_volumes.contains(volumeName);
 }
 
-void stardust::VolumeManager::RemoveVolume(const std::string& volumeName)
+void stardust::VolumeManager::RemoveVolume(const StringID volumeName)
 {
-	if (volumeName != s_MasterVolumeName)
+	if (volumeName != s_MasterVolumeID)
 	{
 		m_volumes.erase(volumeName);
 	}
@@ -42,8 +35,8 @@ void stardust::VolumeManager::RemoveVolume(const std::string& volumeName)
 
 void stardust::VolumeManager::ClearAllVolumes()
 {
-	const float masterVolume = m_volumes[GetMasterVolumeName()];
+	const float masterVolume = m_volumes[s_MasterVolumeID];
 
 	m_volumes.clear();
-	m_volumes[GetMasterVolumeName()] = masterVolume;
+	m_volumes[s_MasterVolumeID] = masterVolume;
 }
\ No newline at end of file
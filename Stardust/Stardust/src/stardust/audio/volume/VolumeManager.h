@@ -6,35 +6,39 @@
 #include <string>
 #include <string_view>
 
+#include "../../utility/string_id/StringID.h"
+
 namespace stardust
 {
 	class VolumeManager
 	{
 	private:
 		static constexpr std::string_view s_MasterVolumeName = "master";
+		static constexpr StringID s_MasterVolumeID{ s_MasterVolumeName };
 
-		std::unordered_map<std::string, float> m_volumes{ };
+		std::unordered_map<StringID, float> m_volumes{ };
 
 	public:
 		[[nodiscard]] inline static std::string GetMasterVolumeName() noexcept { return std::string(s_MasterVolumeName); }
+		[[nodiscard]] inline static constexpr StringID GetMasterVolumeID() noexcept { return s_MasterVolumeID; }
 
 		VolumeManager() = default;
 		~VolumeManager() noexcept = default;
 
-		void AddVolume(const std::string& volumeName, const float value = 1.0f);
-		void SetVolume(const std::string& volumeName, const float value);
-		[[nodiscard]] float GetVolume(const std::string& volumeName) const;
-		void ResetVolume(const std::string& volumeName);
+		void AddVolume(const std::string_view& volumeName, const float value = 1.0f);
+		void SetVolume(const StringID volumeName, const float value);
+		[[nodiscard]] float GetVolume(const StringID volumeName) const;
+		void ResetVolume(const StringID volumeName);
 
-		[[nodiscard]] bool DoesVolumeExist(const std::string& volumeName) const;
+		[[nodiscard]] bool DoesVolumeExist(const StringID volumeName) const;
 
-		void RemoveVolume(const std::string& volumeName);
+		void RemoveVolume(const StringID volumeName);
 		void ClearAllVolumes();
 
-		[[nodiscard]] inline float operator [](const std::string& volumeName) const { return GetVolume(volumeName); }
+		[[nodiscard]] inline float operator [](const StringID volumeName) const { return GetVolume(volumeName); }
 
-		inline std::unordered_map<std::string, float>& GetVolumes() noexcept { return m_volumes; }
-		inline const std::unordered_map<std::string, float>& GetVolumes() const noexcept { return m_volumes; }
+		inline std::unordered_map<StringID, float>& GetVolumes() noexcept { return m_volumes; }
+		inline const std::unordered_map<StringID, float>& GetVolumes() const noexcept { return m_volumes; }
 	};
 }
 
@@ -1,5 +1,7 @@
 #include "Camera.h"
 
+#include <cmath>
+
 #include "../graphics/window/Window.h"
 
 namespace stardust
@@ -29,26 +31,38 @@ namespace stardust
         m_pixelsPerUnit = m_renderer->GetLogicalSize().x / (m_halfSize * 2.0f);
     }
 
-    [[nodiscard]] glm::uvec2 Camera::WorldSpaceToScreenSpace(glm::vec2 position) const noexcept
+    [[nodiscard]] glm::vec2 Camera::GetScreenCentre() const noexcept
     {
-        position.x += m_halfSize;
-        position.y -= m_halfSize / m_aspectRatio;
+        return glm::vec2{ m_halfSize, m_halfSize / m_aspectRatio } * m_pixelsPerUnit;
+    }
 
-        position *= m_pixelsPerUnit;
+    [[nodiscard]] glm::vec2 Camera::WorldSpaceToScreenSpace(const glm::vec2& position) const noexcept
+    {
+        const float angle = glm::radians(m_rotation);
+        const float sine = std::sin(angle);
+        const float cosine = std::cos(angle);
 
-        return glm::uvec2{ position.x, -position.y };
+        const glm::vec2 relativePosition = position - m_position;
+        const glm::vec2 viewPosition{
+            cosine * relativePosition.x + sine * relativePosition.y,
+            cosine * relativePosition.y - sine * relativePosition.x,
+        };
+
+        return GetScreenCentre() + glm::vec2{ viewPosition.x, -viewPosition.y } * GetZoomedPixelsPerUnit();
     }
 
-    [[nodiscard]] glm::vec2 Camera::ScreenSpaceToWorldSpace(const glm::uvec2& position) const noexcept
+    [[nodiscard]] glm::vec2 Camera::ScreenSpaceToWorldSpace(const glm::vec2& position) const noexcept
     {
-        glm::vec2 worldSpace = position;
-        worldSpace.y *= -1.0f;
-
-        worldSpace /= m_pixelsPerUnit;
+        const float angle = glm::radians(m_rotation);
+        const float sine = std::sin(angle);
+        const float cosine = std::cos(angle);
 
-        worldSpace.x -= m_halfSize;
-        worldSpace.y += m_halfSize / m_aspectRatio;
+        glm::vec2 viewPosition = (position - GetScreenCentre()) / GetZoomedPixelsPerUnit();
+        viewPosition.y *= -1.0f;
 
-        return worldSpace;
+        return m_position + glm::vec2{
+            cosine * viewPosition.x - sine * viewPosition.y,
+            sine * viewPosition.x + cosine * viewPosition.y,
+        };
     }
 }
\ No newline at end of file
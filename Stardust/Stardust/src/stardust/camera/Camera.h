@@ -50,9 +50,11 @@ namespace stardust
 
 		inline float GetAspectRatio() const noexcept { return m_aspectRatio; }
 		inline float GetPixelsPerUnit() const noexcept { return m_pixelsPerUnit; }
+		inline float GetZoomedPixelsPerUnit() const noexcept { return m_pixelsPerUnit * m_zoom; }
+		[[nodiscard]] glm::vec2 GetScreenCentre() const noexcept;
 
-		[[nodiscard]] glm::uvec2 WorldSpaceToScreenSpace(glm::vec2 position) const noexcept;
-		[[nodiscard]] glm::vec2 ScreenSpaceToWorldSpace(const glm::uvec2& position) const noexcept;
+		[[nodiscard]] glm::vec2 WorldSpaceToScreenSpace(const glm::vec2& position) const noexcept;
+		[[nodiscard]] glm::vec2 ScreenSpaceToWorldSpace(const glm::vec2& position) const noexcept;
 	};
 }
 
@@ -23,4 +23,9 @@ namespace stardust
 			static_cast<std::uint8_t>(vector.w),
 		};
 	}
+
+	[[nodiscard]] bool AreColoursEqual(const Colour& a, const Colour& b) noexcept
+	{
+		return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+	}
 }
\ No newline at end of file
@@ -43,6 +43,8 @@ namespace stardust
 
 	[[nodiscard]] extern glm::vec4 ColourToVec4(const Colour& colour);
 	[[nodiscard]] extern Colour Vec4ToColour(const glm::vec4& vector);
+
+	[[nodiscard]] extern bool AreColoursEqual(const Colour& a, const Colour& b) noexcept;
 }
 
 #endif
\ No newline at end of file
@@ -1,10 +1,17 @@
 #include "Renderer.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
+#include <iterator>
+#include <limits>
 #include <utility>
 
 #include "../../graphics/window/Window.h"
 #include "../texture/Texture.h"
+#include "command_buffer/CommandBuffer.h"
+#include "sprite_batch/SpriteBatch.h"
 
 namespace stardust
 {
@@ -18,6 +25,18 @@ namespace stardust
 		return static_cast<unsigned int>(SDL_GetNumRenderDrivers());
 	}
 
+	[[nodiscard]] Renderer::BlendMode Renderer::GetPremultipliedAlphaBlendMode() noexcept
+	{
+		return static_cast<BlendMode>(SDL_ComposeCustomBlendMode(
+			SDL_BLENDFACTOR_ONE,
+			SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+			SDL_BLENDOPERATION_ADD,
+			SDL_BLENDFACTOR_ONE,
+			SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+			SDL_BLENDOPERATION_ADD
+		));
+	}
+
 	Renderer::Renderer()
 	{ }
 
@@ -26,28 +45,95 @@ namespace stardust
 		Initialise(window, createInfo);
 	}
 
+	Renderer::Renderer(const PixelSurface& targetSurface, const CreateInfo& createInfo)
+	{
+		Initialise(targetSurface, createInfo);
+	}
+
 	Renderer::Renderer(Renderer&& other) noexcept
-		: m_handle(nullptr), m_window(nullptr), m_presentVSync(false), m_allowRenderToTexture(false), m_currentRenderTarget(nullptr)
+		: m_handle(nullptr), m_window(nullptr), m_targetSurface(nullptr), m_presentVSync(false), m_allowRenderToTexture(false), m_currentRenderTarget(nullptr),
+		  m_drawColour(std::nullopt), m_blendMode(std::nullopt), m_clipRect(std::nullopt),
+		  m_isFrameFullyDirty(true), m_dirtyFrameRegion(std::nullopt),
+		  m_drawMode(DrawMode::Immediate), m_sortLayer(0u), m_sortZ(0), m_deferredDrawCommands({ }), m_deferredSortEntries({ }), m_deferredSortBuffer({ }), m_deferredVertices({ }), m_deferredIndices({ }), m_deferredSpriteBatch(nullptr), m_quadIndices({ }), m_modulatedVertices({ }),
+		  m_statistics(Statistics{ }), m_lastDrawnTexture(nullptr)
 	{
 		std::swap(m_handle, other.m_handle);
 		std::swap(m_window, other.m_window);
+		std::swap(m_targetSurface, other.m_targetSurface);
 
 		std::swap(m_presentVSync, other.m_presentVSync);
 		std::swap(m_allowRenderToTexture, other.m_allowRenderToTexture);
 
 		std::swap(m_currentRenderTarget, other.m_currentRenderTarget);
+
+		std::swap(m_drawColour, other.m_drawColour);
+		std::swap(m_blendMode, other.m_blendMode);
+		std::swap(m_clipRect, other.m_clipRect);
+
+		std::swap(m_isFrameFullyDirty, other.m_isFrameFullyDirty);
+		std::swap(m_dirtyFrameRegion, other.m_dirtyFrameRegion);
+
+		std::swap(m_drawMode, other.m_drawMode);
+		std::swap(m_sortLayer, other.m_sortLayer);
+		std::swap(m_sortZ, other.m_sortZ);
+
+		std::swap(m_deferredDrawCommands, other.m_deferredDrawCommands);
+		std::swap(m_deferredSortEntries, other.m_deferredSortEntries);
+		std::swap(m_deferredSortBuffer, other.m_deferredSortBuffer);
+		std::swap(m_deferredVertices, other.m_deferredVertices);
+		std::swap(m_deferredIndices, other.m_deferredIndices);
+		std::swap(m_deferredSpriteBatch, other.m_deferredSpriteBatch);
+		std::swap(m_quadIndices, other.m_quadIndices);
+		std::swap(m_modulatedVertices, other.m_modulatedVertices);
+
+		std::swap(m_statistics, other.m_statistics);
+		std::swap(m_lastDrawnTexture, other.m_lastDrawnTexture);
+
+		if (m_deferredSpriteBatch != nullptr)
+		{
+			m_deferredSpriteBatch->Initialise(*this);
+		}
 	}
 
 	Renderer& Renderer::operator =(Renderer&& other) noexcept
 	{
 		m_handle = std::exchange(other.m_handle, nullptr);
 		m_window = std::exchange(other.m_window, nullptr);
+		m_targetSurface = std::exchange(other.m_targetSurface, nullptr);
 
 		m_presentVSync = std::exchange(other.m_presentVSync, false);
 		m_allowRenderToTexture = std::exchange(other.m_allowRenderToTexture, false);
 
 		m_currentRenderTarget = std::exchange(other.m_currentRenderTarget, nullptr);
 
+		m_drawColour = std::exchange(other.m_drawColour, std::nullopt);
+		m_blendMode = std::exchange(other.m_blendMode, std::nullopt);
+		m_clipRect = std::exchange(other.m_clipRect, std::nullopt);
+
+		m_isFrameFullyDirty = std::exchange(other.m_isFrameFullyDirty, true);
+		m_dirtyFrameRegion = std::exchange(other.m_dirtyFrameRegion, std::nullopt);
+
+		m_drawMode = std::exchange(other.m_drawMode, DrawMode::Immediate);
+		m_sortLayer = std::exchange(other.m_sortLayer, 0u);
+		m_sortZ = std::exchange(other.m_sortZ, 0);
+
+		m_deferredDrawCommands = std::exchange(other.m_deferredDrawCommands, { });
+		m_deferredSortEntries = std::exchange(other.m_deferredSortEntries, { });
+		m_deferredSortBuffer = std::exchange(other.m_deferredSortBuffer, { });
+		m_deferredVertices = std::exchange(other.m_deferredVertices, { });
+		m_deferredIndices = std::exchange(other.m_deferredIndices, { });
+		m_deferredSpriteBatch = std::exchange(other.m_deferredSpriteBatch, nullptr);
+		m_quadIndices = std::exchange(other.m_quadIndices, { });
+		m_modulatedVertices = std::exchange(other.m_modulatedVertices, { });
+
+		m_statistics = std::exchange(other.m_statistics, Statistics{ });
+		m_lastDrawnTexture = std::exchange(other.m_lastDrawnTexture, nullptr);
+
+		if (m_deferredSpriteBatch != nullptr)
+		{
+			m_deferredSpriteBatch->Initialise(*this);
+		}
+
 		return *this;
 	}
 
@@ -75,11 +161,18 @@ namespace stardust
 		if (m_handle != nullptr)
 		{
 			m_window = &window;
+			InitialiseState(createInfo);
+		}
+	}
 
-			m_presentVSync = createInfo.presentVSync;
-			m_allowRenderToTexture = createInfo.allowRenderToTexture;
+	void Renderer::Initialise(const PixelSurface& targetSurface, const CreateInfo& createInfo)
+	{
+		m_handle = std::unique_ptr<SDL_Renderer, RendererDestroyer>(SDL_CreateSoftwareRenderer(targetSurface.GetRawHandle()));
 
-			SetBlendMode(createInfo.blendMode);
+		if (m_handle != nullptr)
+		{
+			m_targetSurface = &targetSurface;
+			InitialiseState(createInfo);
 		}
 	}
 
@@ -88,9 +181,31 @@ namespace stardust
 		if (m_handle != nullptr)
 		{
 			m_handle = nullptr;
+			m_window = nullptr;
+			m_targetSurface = nullptr;
 
 			m_presentVSync = false;
 			m_allowRenderToTexture = false;
+
+			m_currentRenderTarget = nullptr;
+			m_drawColour = std::nullopt;
+			m_blendMode = std::nullopt;
+			m_clipRect = std::nullopt;
+
+			m_isFrameFullyDirty = true;
+			m_dirtyFrameRegion = std::nullopt;
+
+			m_drawMode = DrawMode::Immediate;
+			m_deferredDrawCommands.clear();
+			m_deferredSortEntries.clear();
+			m_deferredSortBuffer.clear();
+			m_deferredVertices.clear();
+			m_deferredIndices.clear();
+			m_deferredSpriteBatch = nullptr;
+			m_quadIndices.clear();
+
+			m_statistics = Statistics{ };
+			m_lastDrawnTexture = nullptr;
 		}
 	}
 
@@ -104,42 +219,92 @@ namespace stardust
 
 	void Renderer::SetViewport(const rect::Rect& viewport) const
 	{
+		FlushDeferredDraws();
+
 		SDL_RenderSetViewport(GetRawHandle(), &viewport);
 	}
 
 	void Renderer::ResetViewport() const
 	{
+		FlushDeferredDraws();
+
 		SDL_RenderSetViewport(GetRawHandle(), nullptr);
 	}
 
-	[[nodiscard]] bool Renderer::IsClipRectActive() const noexcept
+	[[nodiscard]] rect::Rect Renderer::GetClipRect() const
 	{
-		return static_cast<bool>(SDL_RenderIsClipEnabled(GetRawHandle()));
+		return m_clipRect.value_or(rect::Rect{ 0u, 0u, 0u, 0u });
 	}
 
-	[[nodiscard]] rect::Rect Renderer::GetClipRect() const
+	void Renderer::SetClipRect(const rect::Rect& clipRect) const
 	{
-		if (IsClipRectActive())
+		const bool isRedundant = m_clipRect.has_value() && rect::AreEqual(m_clipRect.value(), clipRect);
+		RecordStateChange(m_statistics.clipRectChanges, isRedundant);
+
+		if (isRedundant)
 		{
-			rect::Rect clipRect{ };
-			SDL_RenderGetClipRect(GetRawHandle(), &clipRect);
+			return;
+		}
+
+		FlushDeferredDraws();
 
-			return clipRect;
+		if (SDL_RenderSetClipRect(GetRawHandle(), &clipRect) == 0)
+		{
+			m_clipRect = clipRect;
 		}
-		else
+	}
+
+	void Renderer::RemoveClipRect() const
+	{
+		const bool isRedundant = !m_clipRect.has_value();
+		RecordStateChange(m_statistics.clipRectChanges, isRedundant);
+
+		if (isRedundant)
+		{
+			return;
+		}
+
+		FlushDeferredDraws();
+
+		if (SDL_RenderSetClipRect(GetRawHandle(), nullptr) == 0)
 		{
-			return rect::Rect{ 0u, 0u, 0u, 0u };
+			m_clipRect = std::nullopt;
 		}
 	}
 
-	void Renderer::SetClipRect(const rect::Rect& clipRect) const
+	[[nodiscard]] rect::Rect Renderer::GetCullBounds() const
+	{
+		const rect::Rect viewport = GetViewport();
+		const rect::Rect viewportBounds = rect::Create(0, 0, static_cast<unsigned int>(viewport.w), static_cast<unsigned int>(viewport.h));
+
+		if (!m_clipRect.has_value())
+		{
+			return viewportBounds;
+		}
+
+		return rect::GetIntersection(viewportBounds, m_clipRect.value()).value_or(rect::Rect{ 0, 0, 0, 0 });
+	}
+
+	void Renderer::MarkFrameDirty() const noexcept
 	{
-		SDL_RenderSetClipRect(GetRawHandle(), &clipRect);
+		m_isFrameFullyDirty = true;
+		m_dirtyFrameRegion = std::nullopt;
 	}
 
-	void Renderer::RemoveClipRect() const
+	void Renderer::MarkFrameDirty(const rect::Rect& region) const
 	{
-		SDL_RenderSetClipRect(GetRawHandle(), nullptr);
+		if (m_isFrameFullyDirty || region.w <= 0 || region.h <= 0)
+		{
+			return;
+		}
+
+		m_dirtyFrameRegion = m_dirtyFrameRegion.has_value() ? rect::GetUnion(m_dirtyFrameRegion.value(), region) : region;
+	}
+
+	void Renderer::ResetFrameDirtyState() const noexcept
+	{
+		m_isFrameFullyDirty = false;
+		m_dirtyFrameRegion = std::nullopt;
 	}
 
 	void Renderer::Flush() const
@@ -149,36 +314,107 @@ namespace stardust
 
 	void Renderer::Clear(const Colour& colour) const
 	{
+		FlushDeferredDraws();
+
 		SetDrawColour(colour);
 		SDL_RenderClear(GetRawHandle());
+		RecordDrawCall(0u, 0u);
 	}
 
 	void Renderer::DrawPoint(const rect::Point& point, const Colour& colour) const
 	{
+		if (m_drawMode == DrawMode::Deferred)
+		{
+			RecordDrawCommand(DrawCommand{
+				.type = DrawCommand::Type::Point,
+				.area = rect::Create(point.x, point.y, 0u, 0u),
+				.colour = colour,
+			});
+
+			return;
+		}
+
+		SetDrawColour(colour);
 		SDL_RenderDrawPoint(GetRawHandle(), point.x, point.y);
+		RecordDrawCall(1u, 1u);
 	}
 
 	void Renderer::DrawPoints(const std::vector<rect::Point>& points, const Colour& colour) const
 	{
+		if (m_drawMode == DrawMode::Deferred)
+		{
+			for (const auto& point : points)
+			{
+				DrawPoint(point, colour);
+			}
+
+			return;
+		}
+
+		SetDrawColour(colour);
 		SDL_RenderDrawPoints(GetRawHandle(), points.data(), static_cast<int>(points.size()));
+		RecordDrawCall(static_cast<unsigned int>(points.size()), points.size());
 	}
 
 	void Renderer::DrawLine(const rect::Line& line, const Colour& colour) const
 	{
+		if (m_drawMode == DrawMode::Deferred)
+		{
+			RecordDrawCommand(DrawCommand{
+				.type = DrawCommand::Type::Line,
+				.area = rect::Rect{ line.first.x, line.first.y, line.second.x, line.second.y },
+				.colour = colour,
+			});
+
+			return;
+		}
+
 		SetDrawColour(colour);
 		SDL_RenderDrawLine(GetRawHandle(), line.first.x, line.first.y, line.second.x, line.second.y);
+		RecordDrawCall(1u, GetLinePixelCount(line.first, line.second));
 	}
 
 	void Renderer::DrawConnectedLines(const std::vector<rect::Point>& points, const Colour& colour) const
 	{
+		if (m_drawMode == DrawMode::Deferred)
+		{
+			for (std::size_t i = 1u; i < points.size(); ++i)
+			{
+				DrawLine(rect::Create(points[i - 1u], points[i]), colour);
+			}
+
+			return;
+		}
+
 		SetDrawColour(colour);
 		SDL_RenderDrawLines(GetRawHandle(), points.data(), static_cast<int>(points.size()));
+
+		std::uint64_t pixelCount = 0u;
+
+		for (std::size_t i = 1u; i < points.size(); ++i)
+		{
+			pixelCount += GetLinePixelCount(points[i - 1u], points[i]);
+		}
+
+		RecordDrawCall(points.empty() ? 0u : static_cast<unsigned int>(points.size() - 1u), pixelCount);
 	}
 
 	void Renderer::DrawRect(const rect::Rect& rect, const Colour& colour, const RectDrawStyle drawStyle) const
 	{
+		if (m_drawMode == DrawMode::Deferred)
+		{
+			RecordDrawCommand(DrawCommand{
+				.type = DrawCommand::Type::Rect,
+				.rectDrawStyle = drawStyle,
+				.area = rect,
+				.colour = colour,
+			});
+
+			return;
+		}
+
 		SetDrawColour(colour);
-		
+
 		switch (drawStyle)
 		{
 		case RectDrawStyle::Outline:
@@ -192,10 +428,22 @@ namespace stardust
 
 			break;
 		}
+
+		RecordDrawCall(1u, GetRectPixelCount(rect, drawStyle));
 	}
 
 	void Renderer::DrawRects(const std::vector<rect::Rect>& rects, const Colour& colour, const RectDrawStyle drawStyle) const
 	{
+		if (m_drawMode == DrawMode::Deferred)
+		{
+			for (const auto& rect : rects)
+			{
+				DrawRect(rect, colour, drawStyle);
+			}
+
+			return;
+		}
+
 		SetDrawColour(colour);
 
 		switch (drawStyle)
@@ -211,10 +459,26 @@ namespace stardust
 
 			break;
 		}
+
+		std::uint64_t pixelCount = 0u;
+
+		for (const auto& rect : rects)
+		{
+			pixelCount += GetRectPixelCount(rect, drawStyle);
+		}
+
+		RecordDrawCall(static_cast<unsigned int>(rects.size()), pixelCount);
 	}
 
 	void Renderer::DrawTexture(const Texture& texture, const std::optional<rect::Rect>& sourceRect, const glm::vec2& position, const glm::vec2& scale) const
 	{
+		if (m_drawMode == DrawMode::Deferred)
+		{
+			DrawRotatedTexture(texture, sourceRect, position, scale, 0.0f);
+
+			return;
+		}
+
 		const glm::vec2 textureSize{
 			(sourceRect.has_value() ? sourceRect->w : texture.GetSize().x) * scale.x,
 			(sourceRect.has_value() ? sourceRect->h : texture.GetSize().y) * scale.y,
@@ -228,7 +492,16 @@ namespace stardust
 			static_cast<unsigned int>(textureSize.y)
 		);
 
+		if (IsAreaCulled(destinationRect))
+		{
+			++m_statistics.culledDraws;
+
+			return;
+		}
+
+		texture.ApplyPendingModulation();
 		SDL_RenderCopy(GetRawHandle(), texture.GetRawHandle(), sourceRectPointer, &destinationRect);
+		RecordDrawCall(1u, static_cast<std::uint64_t>(destinationRect.w) * static_cast<std::uint64_t>(destinationRect.h), texture.GetRawHandle());
 	}
 
 	void Renderer::DrawRotatedTexture(
@@ -246,7 +519,6 @@ namespace stardust
 			(sourceRect.has_value() ? sourceRect->h : texture.GetSize().y) * scale.y,
 		};
 
-		const rect::Rect* sourceRectPointer = sourceRect.has_value() ? &sourceRect.value() : nullptr;
 		const rect::Rect destinationRect = rect::Create(
 			static_cast<int>(position.x - textureSize.x / 2.0f),
 			static_cast<int>(position.y - textureSize.y / 2.0f),
@@ -256,11 +528,102 @@ namespace stardust
 
 		const rect::Point centrePoint = rect::Create(destinationRect.w / 2 + rotationOffset.x, destinationRect.h / 2 + rotationOffset.y);
 
+		if (IsAreaCulled(destinationRect, angle, centrePoint))
+		{
+			++m_statistics.culledDraws;
+
+			return;
+		}
+
+		if (m_drawMode == DrawMode::Deferred)
+		{
+			const auto [redMod, greenMod, blueMod] = texture.GetColourMod();
+
+			RecordDrawCommand(DrawCommand{
+				.type = DrawCommand::Type::Texture,
+				.flipAxis = flipAxis,
+				.hasSourceRect = sourceRect.has_value(),
+				.texture = &texture,
+				.sourceRect = sourceRect.value_or(rect::Rect{ }),
+				.position = position,
+				.scale = scale,
+				.angle = angle,
+				.rotationOffset = rotationOffset,
+				.colour = Colour{ redMod, greenMod, blueMod, texture.GetAlphaMod() },
+			});
+
+			return;
+		}
+
+		const rect::Rect* sourceRectPointer = sourceRect.has_value() ? &sourceRect.value() : nullptr;
+
+		texture.ApplyPendingModulation();
 		SDL_RenderCopyEx(GetRawHandle(), texture.GetRawHandle(), sourceRectPointer, &destinationRect, angle, &centrePoint, static_cast<SDL_RendererFlip>(flipAxis));
+		RecordDrawCall(1u, static_cast<std::uint64_t>(destinationRect.w) * static_cast<std::uint64_t>(destinationRect.h), texture.GetRawHandle());
+	}
+
+	void Renderer::DrawGeometry(const std::span<const Vertex>& vertices, const std::span<const int>& indices, const Texture* const texture) const
+	{
+		if (m_drawMode == DrawMode::Deferred)
+		{
+			RecordDrawCommand(DrawCommand{
+				.type = DrawCommand::Type::Geometry,
+				.texture = texture,
+				.firstVertex = static_cast<std::uint32_t>(m_deferredVertices.size()),
+				.vertexCount = static_cast<std::uint32_t>(vertices.size()),
+				.firstIndex = static_cast<std::uint32_t>(m_deferredIndices.size()),
+				.indexCount = static_cast<std::uint32_t>(indices.size()),
+			});
+
+			m_deferredVertices.insert(std::cend(m_deferredVertices), std::cbegin(vertices), std::cend(vertices));
+			m_deferredIndices.insert(std::cend(m_deferredIndices), std::cbegin(indices), std::cend(indices));
+
+			return;
+		}
+
+		SDL_Texture* textureHandle = nullptr;
+
+		if (texture != nullptr)
+		{
+			texture->ApplyPendingModulation();
+			textureHandle = texture->GetRawHandle();
+		}
+
+		const int* const indicesPointer = !indices.empty() ? indices.data() : nullptr;
+
+		SDL_RenderGeometry(GetRawHandle(), textureHandle, vertices.data(), static_cast<int>(vertices.size()), indicesPointer, static_cast<int>(indices.size()));
+
+		const std::size_t triangleCount = (indices.empty() ? vertices.size() : indices.size()) / 3u;
+		float filledArea = 0.0f;
+
+		for (std::size_t i = 0u; i < triangleCount; ++i)
+		{
+			const SDL_FPoint& a = vertices[indices.empty() ? i * 3u : static_cast<std::size_t>(indices[i * 3u])].position;
+			const SDL_FPoint& b = vertices[indices.empty() ? i * 3u + 1u : static_cast<std::size_t>(indices[i * 3u + 1u])].position;
+			const SDL_FPoint& c = vertices[indices.empty() ? i * 3u + 2u : static_cast<std::size_t>(indices[i * 3u + 2u])].position;
+
+			filledArea += std::abs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2.0f;
+		}
+
+		RecordDrawCall(static_cast<unsigned int>(triangleCount), static_cast<std::uint64_t>(filledArea), textureHandle);
 	}
 
 	[[nodiscard]] PixelSurface Renderer::ReadPixels(const std::optional<rect::Rect>& areaToRead) const
 	{
+		PixelSurface pixelData;
+
+		if (ReadPixels(pixelData, areaToRead) == Status::Fail)
+		{
+			return PixelSurface();
+		}
+
+		return pixelData;
+	}
+
+	[[nodiscard]] Status Renderer::ReadPixels(PixelSurface& out_pixelData, const std::optional<rect::Rect>& areaToRead) const
+	{
+		FlushDeferredDraws();
+
 		unsigned int width = 0u;
 		unsigned int height = 0u;
 
@@ -277,48 +640,209 @@ namespace stardust
 		}
 		else
 		{
-			width = m_window->GetSize().x;
-			height = m_window->GetSize().y;
+			width = GetDisplaySize().x;
+			height = GetDisplaySize().y;
 		}
 
-		PixelSurface pixelData(width, height, 4u);
-
-		if (!pixelData.IsValid())
+		if (!out_pixelData.IsValid() || out_pixelData.GetSize() != glm::uvec2{ width, height })
 		{
-			return PixelSurface();
+			out_pixelData.Initialise(width, height, 4u);
+
+			if (!out_pixelData.IsValid())
+			{
+				return Status::Fail;
+			}
 		}
 
 		const rect::Rect* readAreaPointer = areaToRead.has_value() ? &areaToRead.value() : nullptr;
-		pixelData.Lock();
+		out_pixelData.Lock();
 
-		if (SDL_RenderReadPixels(GetRawHandle(), readAreaPointer, pixelData.GetFormat(), pixelData.GetPixels(), static_cast<int>(pixelData.GetPitch())) != 0)
+		if (SDL_RenderReadPixels(GetRawHandle(), readAreaPointer, out_pixelData.GetFormat(), out_pixelData.GetPixels(), static_cast<int>(out_pixelData.GetPitch())) != 0)
 		{
-			pixelData.Unlock();
-			
-			return PixelSurface();
+			out_pixelData.Unlock();
+
+			return Status::Fail;
 		}
 
-		pixelData.Unlock();
+		out_pixelData.Unlock();
 
-		return pixelData;
+		return Status::Success;
 	}
 
 	void Renderer::SetCurrentRenderTarget(Texture& targetTexture) const
 	{
 		if (m_allowRenderToTexture)
 		{
+			const bool isRedundant = m_currentRenderTarget == &targetTexture;
+			RecordStateChange(m_statistics.renderTargetChanges, isRedundant);
+
+			if (isRedundant)
+			{
+				return;
+			}
+
+			FlushDeferredDraws();
+
 			if (SDL_SetRenderTarget(GetRawHandle(), targetTexture.GetRawHandle()) == 0)
 			{
 				m_currentRenderTarget = &targetTexture;
+				SynchroniseClipRect();
 			}
 		}
 	}
 
 	void Renderer::ResetRenderTarget() const
 	{
+		const bool isRedundant = m_currentRenderTarget == nullptr;
+		RecordStateChange(m_statistics.renderTargetChanges, isRedundant);
+
+		if (isRedundant)
+		{
+			return;
+		}
+
+		FlushDeferredDraws();
+
 		if (SDL_SetRenderTarget(GetRawHandle(), nullptr) == 0)
 		{
 			m_currentRenderTarget = nullptr;
+			SynchroniseClipRect();
+		}
+	}
+
+	void Renderer::SetDrawMode(const DrawMode drawMode) const
+	{
+		if (drawMode == DrawMode::Immediate)
+		{
+			FlushDeferredDraws();
+		}
+		else if (m_deferredSpriteBatch == nullptr)
+		{
+			m_deferredSpriteBatch = std::make_unique<SpriteBatch>(*this);
+		}
+
+		m_drawMode = drawMode;
+	}
+
+	void Renderer::SetSortZ(const int sortZ) const noexcept
+	{
+		m_sortZ = static_cast<std::int16_t>(std::clamp(sortZ, static_cast<int>(std::numeric_limits<std::int16_t>::min()), static_cast<int>(std::numeric_limits<std::int16_t>::max())));
+	}
+
+	void Renderer::FlushDeferredDraws() const
+	{
+		if (m_deferredDrawCommands.empty())
+		{
+			return;
+		}
+
+		SortDeferredDrawCommands();
+
+		const BlendMode blendMode = GetBlendMode();
+		m_drawMode = DrawMode::Immediate;
+		m_deferredSpriteBatch->Begin(false);
+
+		for (const auto& sortEntry : m_deferredSortEntries)
+		{
+			const DrawCommand& drawCommand = m_deferredDrawCommands[sortEntry.commandIndex];
+
+			if (drawCommand.type == DrawCommand::Type::Texture)
+			{
+				m_deferredSpriteBatch->Draw(SpriteBatch::Sprite{
+					.texture = drawCommand.texture,
+					.sourceRect = drawCommand.hasSourceRect ? std::optional<rect::Rect>(drawCommand.sourceRect) : std::nullopt,
+					.position = drawCommand.position,
+					.scale = drawCommand.scale,
+					.angle = drawCommand.angle,
+					.rotationOffset = drawCommand.rotationOffset,
+					.flipAxis = drawCommand.flipAxis,
+					.vertexColours = SpriteBatch::VertexColours{ drawCommand.colour, drawCommand.colour, drawCommand.colour, drawCommand.colour },
+				});
+
+				continue;
+			}
+
+			m_deferredSpriteBatch->Flush();
+			SetBlendMode(drawCommand.blendMode);
+
+			switch (drawCommand.type)
+			{
+			case DrawCommand::Type::Point:
+				DrawPoint(rect::Create(drawCommand.area.x, drawCommand.area.y), drawCommand.colour);
+
+				break;
+
+			case DrawCommand::Type::Line:
+				DrawLine(rect::Create(rect::Create(drawCommand.area.x, drawCommand.area.y), rect::Create(drawCommand.area.w, drawCommand.area.h)), drawCommand.colour);
+
+				break;
+
+			case DrawCommand::Type::Geometry:
+				DrawGeometry(
+					std::span<const Vertex>(m_deferredVertices.data() + drawCommand.firstVertex, drawCommand.vertexCount),
+					std::span<const int>(m_deferredIndices.data() + drawCommand.firstIndex, drawCommand.indexCount),
+					drawCommand.texture
+				);
+
+				break;
+
+			case DrawCommand::Type::Rect:
+			default:
+				DrawRect(drawCommand.area, drawCommand.colour, drawCommand.rectDrawStyle);
+
+				break;
+			}
+		}
+
+		m_deferredSpriteBatch->End();
+		SetBlendMode(blendMode);
+		m_drawMode = DrawMode::Deferred;
+
+		m_deferredDrawCommands.clear();
+		m_deferredSortEntries.clear();
+		m_deferredVertices.clear();
+		m_deferredIndices.clear();
+	}
+
+	void Renderer::Submit(const CommandBuffer& commandBuffer) const
+	{
+		Submit(std::span<const CommandBuffer>(&commandBuffer, 1u));
+	}
+
+	void Renderer::Submit(const std::span<const CommandBuffer>& commandBuffers) const
+	{
+		for (const auto& commandBuffer : commandBuffers)
+		{
+			const std::vector<Vertex>& vertices = commandBuffer.GetVertices();
+
+			for (const auto& batch : commandBuffer.GetBatches())
+			{
+				std::span<const Vertex> batchVertices(vertices.data() + batch.firstVertex, batch.vertexCount);
+				const Colour textureMod = SpriteBatch::GetTextureMod(*batch.texture);
+
+				if (textureMod.r != 255u || textureMod.g != 255u || textureMod.b != 255u || textureMod.a != 255u)
+				{
+					m_modulatedVertices.assign(std::cbegin(batchVertices), std::cend(batchVertices));
+
+					for (auto& vertex : m_modulatedVertices)
+					{
+						vertex.color.r = static_cast<std::uint8_t>(vertex.color.r * textureMod.r / 255u);
+						vertex.color.g = static_cast<std::uint8_t>(vertex.color.g * textureMod.g / 255u);
+						vertex.color.b = static_cast<std::uint8_t>(vertex.color.b * textureMod.b / 255u);
+						vertex.color.a = static_cast<std::uint8_t>(vertex.color.a * textureMod.a / 255u);
+					}
+
+					batchVertices = std::span<const Vertex>(m_modulatedVertices.data(), m_modulatedVertices.size());
+				}
+
+				DrawGeometry(
+					batchVertices,
+					GetQuadIndices(batch.vertexCount / CommandBuffer::VerticesPerSprite),
+					batch.texture
+				);
+			}
+
+			m_statistics.culledDraws += commandBuffer.GetCulledSpriteCount();
 		}
 	}
 
@@ -327,8 +851,33 @@ namespace stardust
 		SDL_RenderPresent(GetRawHandle());
 	}
 
+	void Renderer::ResetStatistics() const noexcept
+	{
+		m_statistics = Statistics{ };
+		m_lastDrawnTexture = nullptr;
+	}
+
+	[[nodiscard]] float Renderer::GetEstimatedOverdraw() const noexcept
+	{
+		glm::uvec2 targetSize = m_currentRenderTarget != nullptr ? m_currentRenderTarget->GetSize() : GetLogicalSize();
+
+		if (targetSize.x == 0u || targetSize.y == 0u)
+		{
+			targetSize = GetOutputSize();
+		}
+
+		const std::uint64_t targetArea = static_cast<std::uint64_t>(targetSize.x) * static_cast<std::uint64_t>(targetSize.y);
+
+		return targetArea != 0u ? static_cast<float>(m_statistics.pixelsFilled) / static_cast<float>(targetArea) : 0.0f;
+	}
+
 	[[nodiscard]] Renderer::BlendMode Renderer::GetBlendMode() const noexcept
 	{
+		if (m_blendMode.has_value())
+		{
+			return m_blendMode.value();
+		}
+
 		SDL_BlendMode blendMode = SDL_BLENDMODE_INVALID;
 		SDL_GetRenderDrawBlendMode(GetRawHandle(), &blendMode);
 
@@ -337,7 +886,13 @@ namespace stardust
 
 	void Renderer::SetBlendMode(const BlendMode blendMode) const noexcept
 	{
-		SDL_SetRenderDrawBlendMode(GetRawHandle(), static_cast<SDL_BlendMode>(blendMode));
+		const bool isRedundant = m_blendMode.has_value() && m_blendMode.value() == blendMode;
+		RecordStateChange(m_statistics.blendModeChanges, isRedundant);
+
+		if (!isRedundant && SDL_SetRenderDrawBlendMode(GetRawHandle(), static_cast<SDL_BlendMode>(blendMode)) == 0)
+		{
+			m_blendMode = blendMode;
+		}
 	}
 
 	[[nodiscard]] glm::uvec2 Renderer::GetOutputSize() const noexcept
@@ -361,11 +916,12 @@ namespace stardust
 	void Renderer::SetLogicalSize(const glm::uvec2& logicalSize) const noexcept
 	{
 		SDL_RenderSetLogicalSize(GetRawHandle(), static_cast<int>(logicalSize.x), static_cast<int>(logicalSize.y));
+		MarkFrameDirty();
 	}
 
 	glm::vec2 Renderer::GetLogicalSizeScale() const noexcept
 	{
-		return static_cast<glm::vec2>(GetLogicalSize()) / static_cast<glm::vec2>(m_window->GetSize());
+		return static_cast<glm::vec2>(GetLogicalSize()) / static_cast<glm::vec2>(GetDisplaySize());
 	}
 
 	[[nodiscard]] glm::vec2 Renderer::GetScale() const noexcept
@@ -392,8 +948,250 @@ namespace stardust
 		SDL_RenderSetIntegerScale(GetRawHandle(), static_cast<SDL_bool>(enableIntegerScaling));
 	}
 
+	void Renderer::InitialiseState(const CreateInfo& createInfo)
+	{
+		m_presentVSync = createInfo.presentVSync;
+		m_allowRenderToTexture = createInfo.allowRenderToTexture;
+
+		SetBlendMode(createInfo.blendMode);
+		SetDrawMode(createInfo.drawMode);
+	}
+
+	[[nodiscard]] glm::uvec2 Renderer::GetDisplaySize() const noexcept
+	{
+		return m_targetSurface != nullptr ? m_targetSurface->GetSize() : m_window->GetSize();
+	}
+
 	void Renderer::SetDrawColour(const Colour& colour) const
 	{
-		SDL_SetRenderDrawColor(GetRawHandle(), colour.r, colour.g, colour.b, colour.a);
+		const bool isRedundant = m_drawColour.has_value() && AreColoursEqual(m_drawColour.value(), colour);
+		RecordStateChange(m_statistics.drawColourChanges, isRedundant);
+
+		if (!isRedundant && SDL_SetRenderDrawColor(GetRawHandle(), colour.r, colour.g, colour.b, colour.a) == 0)
+		{
+			m_drawColour = colour;
+		}
+	}
+
+	[[nodiscard]] bool Renderer::IsAreaCulled(const rect::Rect& area, const float angle, const rect::Point& rotationCentre) const
+	{
+		rect::Rect bounds = area;
+
+		if (angle != 0.0f)
+		{
+			const float radians = glm::radians(angle);
+			const float cosine = std::cos(radians);
+			const float sine = std::sin(radians);
+
+			const glm::vec2 pivot{ area.x + rotationCentre.x, area.y + rotationCentre.y };
+			const std::array<glm::vec2, 4u> corners{
+				glm::vec2{ area.x, area.y },
+				glm::vec2{ area.x + area.w, area.y },
+				glm::vec2{ area.x, area.y + area.h },
+				glm::vec2{ area.x + area.w, area.y + area.h },
+			};
+
+			glm::vec2 minimum{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+			glm::vec2 maximum{ std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+			for (const auto& corner : corners)
+			{
+				const glm::vec2 offset = corner - pivot;
+				const glm::vec2 rotatedCorner{
+					pivot.x + offset.x * cosine - offset.y * sine,
+					pivot.y + offset.x * sine + offset.y * cosine,
+				};
+
+				minimum.x = std::min(minimum.x, rotatedCorner.x);
+				minimum.y = std::min(minimum.y, rotatedCorner.y);
+				maximum.x = std::max(maximum.x, rotatedCorner.x);
+				maximum.y = std::max(maximum.y, rotatedCorner.y);
+			}
+
+			bounds = rect::Create(
+				static_cast<int>(std::floor(minimum.x)) - 1,
+				static_cast<int>(std::floor(minimum.y)) - 1,
+				static_cast<unsigned int>(std::ceil(maximum.x - minimum.x)) + 2u,
+				static_cast<unsigned int>(std::ceil(maximum.y - minimum.y)) + 2u
+			);
+		}
+
+		return !rect::HasIntersection(bounds, GetCullBounds());
+	}
+
+	[[nodiscard]] std::span<const int> Renderer::GetQuadIndices(const std::size_t quadCount) const
+	{
+		constexpr std::size_t IndicesPerQuad = 6u;
+
+		for (std::size_t quad = m_quadIndices.size() / IndicesPerQuad; quad < quadCount; ++quad)
+		{
+			const int firstVertex = static_cast<int>(quad * 4u);
+
+			m_quadIndices.push_back(firstVertex);
+			m_quadIndices.push_back(firstVertex + 1);
+			m_quadIndices.push_back(firstVertex + 2);
+			m_quadIndices.push_back(firstVertex + 2);
+			m_quadIndices.push_back(firstVertex + 3);
+			m_quadIndices.push_back(firstVertex);
+		}
+
+		return std::span<const int>(m_quadIndices.data(), quadCount * IndicesPerQuad);
+	}
+
+	void Renderer::SynchroniseClipRect() const
+	{
+		if (SDL_RenderIsClipEnabled(GetRawHandle()))
+		{
+			rect::Rect clipRect{ };
+			SDL_RenderGetClipRect(GetRawHandle(), &clipRect);
+
+			m_clipRect = clipRect;
+		}
+		else
+		{
+			m_clipRect = std::nullopt;
+		}
+	}
+
+	void Renderer::RecordDrawCall(const unsigned int primitiveCount, const std::uint64_t pixelCount, SDL_Texture* const texture) const noexcept
+	{
+		++m_statistics.drawCalls;
+		m_statistics.primitives += primitiveCount;
+		m_statistics.pixelsFilled += pixelCount;
+
+		if (texture != nullptr && texture != m_lastDrawnTexture)
+		{
+			++m_statistics.textureSwitches;
+			m_lastDrawnTexture = texture;
+		}
+	}
+
+	void Renderer::RecordStateChange(unsigned int& stateChangeCounter, const bool isRedundant) const noexcept
+	{
+		if (isRedundant)
+		{
+			++m_statistics.redundantStateChanges;
+		}
+		else
+		{
+			++stateChangeCounter;
+		}
+	}
+
+	[[nodiscard]] std::uint64_t Renderer::GetLinePixelCount(const rect::Point& start, const rect::Point& end) noexcept
+	{
+		return static_cast<std::uint64_t>(std::max(std::abs(end.x - start.x), std::abs(end.y - start.y))) + 1u;
+	}
+
+	[[nodiscard]] std::uint64_t Renderer::GetRectPixelCount(const rect::Rect& rect, const RectDrawStyle drawStyle) noexcept
+	{
+		const std::uint64_t width = static_cast<std::uint64_t>(std::max(rect.w, 0));
+		const std::uint64_t height = static_cast<std::uint64_t>(std::max(rect.h, 0));
+
+		if (drawStyle == RectDrawStyle::Outline && width > 1u && height > 1u)
+		{
+			return (width + height) * 2u - 4u;
+		}
+
+		return width * height;
+	}
+
+	void Renderer::RecordDrawCommand(DrawCommand drawCommand) const
+	{
+		drawCommand.blendMode = drawCommand.texture != nullptr ? drawCommand.texture->GetBlendMode() : GetBlendMode();
+
+		m_deferredSortEntries.push_back(DrawCommandSortEntry{
+			.sortKey = GenerateSortKey(drawCommand),
+			.commandIndex = static_cast<std::uint32_t>(m_deferredDrawCommands.size()),
+		});
+
+		m_deferredDrawCommands.push_back(drawCommand);
+	}
+
+	[[nodiscard]] std::uint64_t Renderer::GenerateSortKey(const DrawCommand& drawCommand) const
+	{
+		std::uint64_t blendModeIndex = 0u;
+
+		switch (drawCommand.blendMode)
+		{
+		case BlendMode::Alpha:
+			blendModeIndex = 1u;
+
+			break;
+
+		case BlendMode::Additive:
+			blendModeIndex = 2u;
+
+			break;
+
+		case BlendMode::Modulate:
+			blendModeIndex = 3u;
+
+			break;
+
+		case BlendMode::Multiply:
+			blendModeIndex = 4u;
+
+			break;
+
+		case BlendMode::None:
+		default:
+			break;
+		}
+
+		const std::uint64_t textureBits = drawCommand.texture != nullptr
+			? (reinterpret_cast<std::uintptr_t>(drawCommand.texture->GetRawHandle()) >> 4u) & s_SortKeyTextureMask
+			: 0u;
+		const std::uint64_t biasedZ = static_cast<std::uint64_t>(static_cast<int>(m_sortZ) - std::numeric_limits<std::int16_t>::min());
+
+		return (static_cast<std::uint64_t>(m_sortLayer) << s_SortKeyLayerShift)
+			| (biasedZ << s_SortKeyZShift)
+			| (blendModeIndex << s_SortKeyBlendModeShift)
+			| (textureBits << s_SortKeyTextureShift);
+	}
+
+	void Renderer::SortDeferredDrawCommands() const
+	{
+		constexpr std::size_t RadixBitCount = 8u;
+		constexpr std::size_t BucketCount = 1u << RadixBitCount;
+		constexpr std::size_t PassCount = sizeof(std::uint64_t) * 8u / RadixBitCount;
+
+		const std::size_t entryCount = m_deferredSortEntries.size();
+		std::array<std::array<std::uint32_t, BucketCount>, PassCount> bucketCounts{ };
+
+		for (const auto& sortEntry : m_deferredSortEntries)
+		{
+			for (std::size_t pass = 0u; pass < PassCount; ++pass)
+			{
+				++bucketCounts[pass][(sortEntry.sortKey >> (pass * RadixBitCount)) & (BucketCount - 1u)];
+			}
+		}
+
+		m_deferredSortBuffer.resize(entryCount);
+
+		for (std::size_t pass = 0u; pass < PassCount; ++pass)
+		{
+			const std::size_t shift = pass * RadixBitCount;
+			auto& passBucketCounts = bucketCounts[pass];
+
+			if (passBucketCounts[(m_deferredSortEntries.front().sortKey >> shift) & (BucketCount - 1u)] == entryCount)
+			{
+				continue;
+			}
+
+			std::uint32_t bucketOffset = 0u;
+
+			for (auto& bucketCount : passBucketCounts)
+			{
+				bucketOffset += std::exchange(bucketCount, bucketOffset);
+			}
+
+			for (const auto& sortEntry : m_deferredSortEntries)
+			{
+				m_deferredSortBuffer[passBucketCounts[(sortEntry.sortKey >> shift) & (BucketCount - 1u)]++] = sortEntry;
+			}
+
+			std::swap(m_deferredSortEntries, m_deferredSortBuffer);
+		}
 	}
 }
\ No newline at end of file
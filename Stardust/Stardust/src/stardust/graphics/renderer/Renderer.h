@@ -4,8 +4,11 @@
 
 #include "../../utility/interfaces/INoncopyable.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
 #include <type_traits>
 #include <vector>
 
@@ -13,6 +16,7 @@
 #include <SDL2/SDL.h>
 
 #include "../../rect/Rect.h"
+#include "../../utility/enums/Status.h"
 #include "../Colour.h"
 #include "../surface/PixelSurface.h"
 
@@ -22,6 +26,8 @@ namespace stardust
 		: private INoncopyable
 	{
 	public:
+		using Vertex = SDL_Vertex;
+
 		enum class RectDrawStyle
 		{
 			Outline,
@@ -47,12 +53,37 @@ namespace stardust
 			Multiply = SDL_BLENDMODE_MUL,
 		};
 
+		enum class DrawMode
+		{
+			Immediate,
+			Deferred,
+		};
+
 		struct CreateInfo
 		{
 			bool presentVSync;
 			bool allowRenderToTexture;
 
 			BlendMode blendMode;
+			DrawMode drawMode = DrawMode::Immediate;
+		};
+
+		struct Statistics
+		{
+			unsigned int drawCalls = 0u;
+			unsigned int primitives = 0u;
+			unsigned int textureSwitches = 0u;
+
+			unsigned int drawColourChanges = 0u;
+			unsigned int blendModeChanges = 0u;
+			unsigned int renderTargetChanges = 0u;
+			unsigned int clipRectChanges = 0u;
+			unsigned int textureModChanges = 0u;
+			unsigned int redundantStateChanges = 0u;
+
+			unsigned int culledDraws = 0u;
+
+			std::uint64_t pixelsFilled = 0u;
 		};
 
 	private:
@@ -61,19 +92,94 @@ namespace stardust
 			void operator ()(SDL_Renderer* const renderer) const noexcept;
 		};
 
+		struct DrawCommand
+		{
+			enum class Type
+				: std::uint8_t
+			{
+				Point,
+				Line,
+				Rect,
+				Texture,
+				Geometry,
+			};
+
+			Type type;
+			RectDrawStyle rectDrawStyle;
+			FlipAxis flipAxis;
+			bool hasSourceRect;
+
+			const class Texture* texture;
+			rect::Rect sourceRect;
+			rect::Rect area;
+
+			glm::vec2 position;
+			glm::vec2 scale;
+			float angle;
+			glm::uvec2 rotationOffset;
+
+			Colour colour;
+
+			std::uint32_t firstVertex;
+			std::uint32_t vertexCount;
+			std::uint32_t firstIndex;
+			std::uint32_t indexCount;
+
+			BlendMode blendMode;
+		};
+
+		struct DrawCommandSortEntry
+		{
+			std::uint64_t sortKey;
+			std::uint32_t commandIndex;
+		};
+
+		static constexpr unsigned int s_SortKeyLayerShift = 56u;
+		static constexpr unsigned int s_SortKeyZShift = 40u;
+		static constexpr unsigned int s_SortKeyBlendModeShift = 36u;
+		static constexpr unsigned int s_SortKeyTextureShift = 16u;
+		static constexpr std::uint64_t s_SortKeyTextureMask = 0x0F'FF'FF;
+
 		std::unique_ptr<SDL_Renderer, RendererDestroyer> m_handle = nullptr;
 		const class Window* m_window = nullptr;
+		const PixelSurface* m_targetSurface = nullptr;
 
 		bool m_presentVSync = false;
 		bool m_allowRenderToTexture = false;
 
 		mutable class Texture* m_currentRenderTarget = nullptr;
 
+		mutable std::optional<Colour> m_drawColour = std::nullopt;
+		mutable std::optional<BlendMode> m_blendMode = std::nullopt;
+		mutable std::optional<rect::Rect> m_clipRect = std::nullopt;
+
+		mutable bool m_isFrameFullyDirty = true;
+		mutable std::optional<rect::Rect> m_dirtyFrameRegion = std::nullopt;
+
+		mutable DrawMode m_drawMode = DrawMode::Immediate;
+		mutable std::uint8_t m_sortLayer = 0u;
+		mutable std::int16_t m_sortZ = 0;
+
+		mutable std::vector<DrawCommand> m_deferredDrawCommands{ };
+		mutable std::vector<DrawCommandSortEntry> m_deferredSortEntries{ };
+		mutable std::vector<DrawCommandSortEntry> m_deferredSortBuffer{ };
+		mutable std::vector<Vertex> m_deferredVertices{ };
+		mutable std::vector<int> m_deferredIndices{ };
+		mutable std::unique_ptr<class SpriteBatch> m_deferredSpriteBatch;
+
+		mutable std::vector<int> m_quadIndices{ };
+		mutable std::vector<Vertex> m_modulatedVertices{ };
+
+		mutable Statistics m_statistics{ };
+		mutable SDL_Texture* m_lastDrawnTexture = nullptr;
+
 	public:
 		[[nodiscard]] static unsigned int GetRenderDriverCount();
+		[[nodiscard]] static BlendMode GetPremultipliedAlphaBlendMode() noexcept;
 
 		Renderer();
 		explicit Renderer(const class Window& window, const CreateInfo& createInfo);
+		explicit Renderer(const PixelSurface& targetSurface, const CreateInfo& createInfo);
 
 		Renderer(Renderer&& other) noexcept;
 		Renderer& operator =(Renderer&& other) noexcept;
@@ -81,16 +187,25 @@ namespace stardust
 		~Renderer() noexcept;
 
 		void Initialise(const class Window& window, const CreateInfo& createInfo);
+		void Initialise(const PixelSurface& targetSurface, const CreateInfo& createInfo);
 		void Destroy() noexcept;
 
 		[[nodiscard]] rect::Rect GetViewport() const;
 		void SetViewport(const rect::Rect& viewport) const;
 		void ResetViewport() const;
 
-		[[nodiscard]] bool IsClipRectActive() const noexcept;
+		inline bool IsClipRectActive() const noexcept { return m_clipRect.has_value(); }
 		[[nodiscard]] rect::Rect GetClipRect() const;
 		void SetClipRect(const rect::Rect& clipRect) const;
 		void RemoveClipRect() const;
+		[[nodiscard]] rect::Rect GetCullBounds() const;
+
+		void MarkFrameDirty() const noexcept;
+		void MarkFrameDirty(const rect::Rect& region) const;
+		void ResetFrameDirtyState() const noexcept;
+		inline bool IsFrameDirty() const noexcept { return m_isFrameFullyDirty || m_dirtyFrameRegion.has_value(); }
+		inline bool IsFrameFullyDirty() const noexcept { return m_isFrameFullyDirty; }
+		inline const std::optional<rect::Rect>& GetDirtyFrameRegion() const noexcept { return m_dirtyFrameRegion; }
 
 		void Flush() const;
 		void Clear(const Colour& colour) const;
@@ -113,18 +228,41 @@ namespace stardust
 			const FlipAxis flipAxis = FlipAxis::None
 		) const;
 
+		void DrawGeometry(const std::span<const Vertex>& vertices, const std::span<const int>& indices, const class Texture* const texture = nullptr) const;
+
 		[[nodiscard]] PixelSurface ReadPixels(const std::optional<rect::Rect>& areaToRead = std::nullopt) const;
+		[[nodiscard]] Status ReadPixels(PixelSurface& out_pixelData, const std::optional<rect::Rect>& areaToRead = std::nullopt) const;
 
 		inline class Texture* GetCurrentRenderTarget() const noexcept { return m_currentRenderTarget; }
 		void SetCurrentRenderTarget(class Texture& targetTexture) const;
 		void ResetRenderTarget() const;
 
+		inline DrawMode GetDrawMode() const noexcept { return m_drawMode; }
+		void SetDrawMode(const DrawMode drawMode) const;
+
+		inline std::uint8_t GetSortLayer() const noexcept { return m_sortLayer; }
+		inline void SetSortLayer(const std::uint8_t sortLayer) const noexcept { m_sortLayer = sortLayer; }
+		inline int GetSortZ() const noexcept { return m_sortZ; }
+		void SetSortZ(const int sortZ) const noexcept;
+
+		void FlushDeferredDraws() const;
+		inline std::size_t GetDeferredDrawCount() const noexcept { return m_deferredDrawCommands.size(); }
+
+		void Submit(const class CommandBuffer& commandBuffer) const;
+		void Submit(const std::span<const class CommandBuffer>& commandBuffers) const;
+
 		void Present() const;
 
+		inline const Statistics& GetStatistics() const noexcept { return m_statistics; }
+		void ResetStatistics() const noexcept;
+		[[nodiscard]] float GetEstimatedOverdraw() const noexcept;
+
 		inline bool IsValid() const noexcept { return m_handle != nullptr; }
 
 		[[nodiscard]] inline SDL_Renderer* const GetRawHandle() const noexcept { return m_handle.get(); }
 		[[nodiscard]] inline const class Window& GetWindow() const noexcept { return *m_window; }
+		[[nodiscard]] inline const PixelSurface* GetTargetSurface() const noexcept { return m_targetSurface; }
+		inline bool IsHeadless() const noexcept { return m_targetSurface != nullptr; }
 		
 		inline bool IsPresentingVSync() const noexcept { return m_presentVSync; }
 		inline bool CanRenderToTexture() const noexcept { return m_allowRenderToTexture; }
@@ -144,7 +282,25 @@ namespace stardust
 		void SetIntegerScaling(const bool enableIntegerScaling) const noexcept;
 
 	private:
+		friend class Texture;
+
+		void InitialiseState(const CreateInfo& createInfo);
+		[[nodiscard]] glm::uvec2 GetDisplaySize() const noexcept;
+
 		void SetDrawColour(const Colour& colour) const;
+		void SynchroniseClipRect() const;
+		[[nodiscard]] bool IsAreaCulled(const rect::Rect& area, const float angle = 0.0f, const rect::Point& rotationCentre = rect::Point{ 0, 0 }) const;
+
+		void RecordDrawCall(const unsigned int primitiveCount, const std::uint64_t pixelCount, SDL_Texture* const texture = nullptr) const noexcept;
+		void RecordStateChange(unsigned int& stateChangeCounter, const bool isRedundant) const noexcept;
+		[[nodiscard]] static std::uint64_t GetLinePixelCount(const rect::Point& start, const rect::Point& end) noexcept;
+		[[nodiscard]] static std::uint64_t GetRectPixelCount(const rect::Rect& rect, const RectDrawStyle drawStyle) noexcept;
+
+		void RecordDrawCommand(DrawCommand drawCommand) const;
+		[[nodiscard]] std::uint64_t GenerateSortKey(const DrawCommand& drawCommand) const;
+		void SortDeferredDrawCommands() const;
+
+		[[nodiscard]] std::span<const int> GetQuadIndices(const std::size_t quadCount) const;
 	};
 }
 
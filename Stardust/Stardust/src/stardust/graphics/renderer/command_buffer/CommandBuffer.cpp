@@ -0,0 +1,135 @@
+#include "CommandBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace stardust
+{
+	CommandBuffer::CommandBuffer(CommandBuffer&& other) noexcept
+		: m_vertices({ }), m_batches({ }), m_cullBounds(std::nullopt), m_culledSpriteCount(0u)
+	{
+		std::swap(m_vertices, other.m_vertices);
+		std::swap(m_batches, other.m_batches);
+
+		std::swap(m_cullBounds, other.m_cullBounds);
+		std::swap(m_culledSpriteCount, other.m_culledSpriteCount);
+	}
+
+	CommandBuffer& CommandBuffer::operator =(CommandBuffer&& other) noexcept
+	{
+		m_vertices = std::exchange(other.m_vertices, { });
+		m_batches = std::exchange(other.m_batches, { });
+
+		m_cullBounds = std::exchange(other.m_cullBounds, std::nullopt);
+		m_culledSpriteCount = std::exchange(other.m_culledSpriteCount, 0u);
+
+		return *this;
+	}
+
+	void CommandBuffer::Begin(const std::optional<rect::Rect>& cullBounds)
+	{
+		m_vertices.clear();
+		m_batches.clear();
+
+		m_cullBounds = cullBounds;
+		m_culledSpriteCount = 0u;
+	}
+
+	void CommandBuffer::Draw(const SpriteBatch::Sprite& sprite)
+	{
+		if (sprite.texture == nullptr)
+		{
+			return;
+		}
+
+		const std::size_t firstVertex = m_vertices.size();
+		SpriteBatch::AppendSpriteVertices(sprite, colours::White, m_vertices);
+
+		if (IsSpriteCulled(firstVertex))
+		{
+			m_vertices.resize(firstVertex);
+			++m_culledSpriteCount;
+
+			return;
+		}
+
+		if (!m_batches.empty() && m_batches.back().texture == sprite.texture)
+		{
+			m_batches.back().vertexCount += static_cast<std::uint32_t>(VerticesPerSprite);
+		}
+		else
+		{
+			m_batches.push_back(Batch{
+				.texture = sprite.texture,
+				.firstVertex = static_cast<std::uint32_t>(firstVertex),
+				.vertexCount = static_cast<std::uint32_t>(VerticesPerSprite),
+			});
+		}
+	}
+
+	void CommandBuffer::Draw(const Texture& texture, const std::optional<rect::Rect>& sourceRect, const glm::vec2& position, const glm::vec2& scale, const Colour& colour)
+	{
+		Draw(SpriteBatch::Sprite{
+			.texture = &texture,
+			.sourceRect = sourceRect,
+			.position = position,
+			.scale = scale,
+			.vertexColours = SpriteBatch::VertexColours{ colour, colour, colour, colour },
+		});
+	}
+
+	void CommandBuffer::DrawRotated(
+		const Texture& texture,
+		const std::optional<rect::Rect>& sourceRect,
+		const glm::vec2& position,
+		const glm::vec2& scale,
+		const float angle,
+		const glm::uvec2& rotationOffset,
+		const Renderer::FlipAxis flipAxis,
+		const Colour& colour
+	)
+	{
+		Draw(SpriteBatch::Sprite{
+			.texture = &texture,
+			.sourceRect = sourceRect,
+			.position = position,
+			.scale = scale,
+			.angle = angle,
+			.rotationOffset = rotationOffset,
+			.flipAxis = flipAxis,
+			.vertexColours = SpriteBatch::VertexColours{ colour, colour, colour, colour },
+		});
+	}
+
+	[[nodiscard]] bool CommandBuffer::IsSpriteCulled(const std::size_t firstVertex) const
+	{
+		if (!m_cullBounds.has_value())
+		{
+			return false;
+		}
+
+		glm::vec2 minimum{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+		glm::vec2 maximum{ std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+		for (std::size_t i = firstVertex; i < firstVertex + VerticesPerSprite; ++i)
+		{
+			const SDL_FPoint& position = m_vertices[i].position;
+
+			minimum.x = std::min(minimum.x, position.x);
+			minimum.y = std::min(minimum.y, position.y);
+			maximum.x = std::max(maximum.x, position.x);
+			maximum.y = std::max(maximum.y, position.y);
+		}
+
+		const rect::Rect bounds = rect::Create(
+			static_cast<int>(std::floor(minimum.x)) - 1,
+			static_cast<int>(std::floor(minimum.y)) - 1,
+			static_cast<unsigned int>(std::ceil(maximum.x - minimum.x)) + 2u,
+			static_cast<unsigned int>(std::ceil(maximum.y - minimum.y)) + 2u
+		);
+
+		return !rect::HasIntersection(bounds, m_cullBounds.value());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include "../../../utility/interfaces/INoncopyable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../../../rect/Rect.h"
+#include "../../Colour.h"
+#include "../../texture/Texture.h"
+#include "../sprite_batch/SpriteBatch.h"
+#include "../Renderer.h"
+
+namespace stardust
+{
+	class CommandBuffer
+		: private INoncopyable
+	{
+	public:
+		static constexpr std::size_t VerticesPerSprite = 4u;
+
+		struct Batch
+		{
+			const Texture* texture;
+
+			std::uint32_t firstVertex;
+			std::uint32_t vertexCount;
+		};
+
+	private:
+		std::vector<Renderer::Vertex> m_vertices{ };
+		std::vector<Batch> m_batches{ };
+
+		std::optional<rect::Rect> m_cullBounds = std::nullopt;
+		unsigned int m_culledSpriteCount = 0u;
+
+	public:
+		CommandBuffer() = default;
+
+		CommandBuffer(CommandBuffer&& other) noexcept;
+		CommandBuffer& operator =(CommandBuffer&& other) noexcept;
+
+		~CommandBuffer() noexcept = default;
+
+		void Begin(const std::optional<rect::Rect>& cullBounds = std::nullopt);
+		void Draw(const SpriteBatch::Sprite& sprite);
+		void Draw(const Texture& texture, const std::optional<rect::Rect>& sourceRect, const glm::vec2& position, const glm::vec2& scale, const Colour& colour = colours::White);
+		void DrawRotated(
+			const Texture& texture,
+			const std::optional<rect::Rect>& sourceRect,
+			const glm::vec2& position,
+			const glm::vec2& scale,
+			const float angle,
+			const glm::uvec2& rotationOffset = glm::uvec2{ 0u, 0u },
+			const Renderer::FlipAxis flipAxis = Renderer::FlipAxis::None,
+			const Colour& colour = colours::White
+		);
+
+		inline bool IsEmpty() const noexcept { return m_batches.empty(); }
+
+		inline const std::vector<Renderer::Vertex>& GetVertices() const noexcept { return m_vertices; }
+		inline const std::vector<Batch>& GetBatches() const noexcept { return m_batches; }
+
+		inline std::size_t GetSpriteCount() const noexcept { return m_vertices.size() / VerticesPerSprite; }
+		inline unsigned int GetCulledSpriteCount() const noexcept { return m_culledSpriteCount; }
+
+	private:
+		[[nodiscard]] bool IsSpriteCulled(const std::size_t firstVertex) const;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include "CommandRecorder.h"
+
+#include <utility>
+
+namespace stardust
+{
+	[[nodiscard]] unsigned int CommandRecorder::GetDefaultWorkerCount() noexcept
+	{
+		const unsigned int hardwareThreadCount = std::thread::hardware_concurrency();
+
+		return hardwareThreadCount > 1u ? hardwareThreadCount - 1u : 1u;
+	}
+
+	CommandRecorder::CommandRecorder(const unsigned int workerCount)
+	{
+		Initialise(workerCount);
+	}
+
+	CommandRecorder::~CommandRecorder() noexcept
+	{
+		Destroy();
+	}
+
+	void CommandRecorder::Initialise(const unsigned int workerCount)
+	{
+		Destroy();
+
+		m_isRunning = true;
+
+		const unsigned int threadCount = std::max(workerCount, 1u);
+		m_workerThreads.reserve(threadCount);
+
+		for (unsigned int i = 0u; i < threadCount; ++i)
+		{
+			m_workerThreads.emplace_back(&CommandRecorder::ProcessTasks, this);
+		}
+	}
+
+	void CommandRecorder::Destroy() noexcept
+	{
+		if (m_isRunning)
+		{
+			{
+				const std::scoped_lock<std::mutex> lock(m_taskMutex);
+
+				m_isRunning = false;
+			}
+
+			m_taskCondition.notify_all();
+
+			for (auto& workerThread : m_workerThreads)
+			{
+				workerThread.join();
+			}
+
+			m_workerThreads.clear();
+			m_tasks.clear();
+			m_pendingTaskCount = 0u;
+			m_workerException = nullptr;
+		}
+	}
+
+	void CommandRecorder::Run(std::vector<Task>&& workerTasks, const Task& callingThreadTask)
+	{
+		if (!m_isRunning)
+		{
+			for (const auto& workerTask : workerTasks)
+			{
+				workerTask();
+			}
+
+			callingThreadTask();
+
+			return;
+		}
+
+		{
+			const std::scoped_lock<std::mutex> lock(m_taskMutex);
+
+			m_pendingTaskCount += workerTasks.size();
+			m_workerException = nullptr;
+
+			for (auto& workerTask : workerTasks)
+			{
+				m_tasks.push_back(std::move(workerTask));
+			}
+		}
+
+		m_taskCondition.notify_all();
+
+		std::exception_ptr callingThreadException = nullptr;
+
+		try
+		{
+			callingThreadTask();
+		}
+		catch (...)
+		{
+			callingThreadException = std::current_exception();
+		}
+
+		std::exception_ptr workerException = nullptr;
+
+		{
+			std::unique_lock<std::mutex> lock(m_taskMutex);
+			m_completionCondition.wait(lock, [this]() { return m_pendingTaskCount == 0u; });
+
+			workerException = std::exchange(m_workerException, nullptr);
+		}
+
+		if (callingThreadException != nullptr)
+		{
+			std::rethrow_exception(callingThreadException);
+		}
+
+		if (workerException != nullptr)
+		{
+			std::rethrow_exception(workerException);
+		}
+	}
+
+	void CommandRecorder::ProcessTasks()
+	{
+		while (true)
+		{
+			Task task;
+
+			{
+				std::unique_lock<std::mutex> lock(m_taskMutex);
+				m_taskCondition.wait(lock, [this]() { return !m_isRunning || !m_tasks.empty(); });
+
+				if (!m_isRunning)
+				{
+					return;
+				}
+
+				task = std::move(m_tasks.front());
+				m_tasks.pop_front();
+			}
+
+			std::exception_ptr taskException = nullptr;
+
+			try
+			{
+				task();
+			}
+			catch (...)
+			{
+				taskException = std::current_exception();
+			}
+
+			{
+				const std::scoped_lock<std::mutex> lock(m_taskMutex);
+
+				if (taskException != nullptr && m_workerException == nullptr)
+				{
+					m_workerException = taskException;
+				}
+
+				--m_pendingTaskCount;
+			}
+
+			m_completionCondition.notify_all();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+#ifndef COMMAND_RECORDER_H
+#define COMMAND_RECORDER_H
+
+#include "../../../utility/interfaces/INoncopyable.h"
+#include "../../../utility/interfaces/INonmovable.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "../../../rect/Rect.h"
+#include "CommandBuffer.h"
+
+namespace stardust
+{
+	class CommandRecorder
+		: private INoncopyable, private INonmovable
+	{
+	public:
+		using Task = std::function<void()>;
+
+	private:
+		std::vector<std::thread> m_workerThreads{ };
+		bool m_isRunning = false;
+
+		std::mutex m_taskMutex;
+		std::condition_variable m_taskCondition;
+		std::deque<Task> m_tasks{ };
+
+		std::condition_variable m_completionCondition;
+		std::size_t m_pendingTaskCount = 0u;
+		std::exception_ptr m_workerException = nullptr;
+
+	public:
+		[[nodiscard]] static unsigned int GetDefaultWorkerCount() noexcept;
+
+		CommandRecorder() = default;
+		explicit CommandRecorder(const unsigned int workerCount);
+		~CommandRecorder() noexcept;
+
+		void Initialise(const unsigned int workerCount = GetDefaultWorkerCount());
+		void Destroy() noexcept;
+
+		template <typename Iterator, typename RecordFunction>
+		void Record(std::vector<CommandBuffer>& commandBuffers, const std::optional<rect::Rect>& cullBounds, const Iterator begin, const Iterator end, const RecordFunction& recordFunction)
+		{
+			if (commandBuffers.empty())
+			{
+				return;
+			}
+
+			const std::size_t elementCount = static_cast<std::size_t>(std::distance(begin, end));
+			const std::size_t elementsPerBuffer = (elementCount + commandBuffers.size() - 1u) / commandBuffers.size();
+
+			std::vector<Task> workerTasks{ };
+			workerTasks.reserve(commandBuffers.size() - 1u);
+
+			Iterator rangeBegin = begin;
+			Iterator firstRangeEnd = begin;
+			std::size_t remainingElementCount = elementCount;
+
+			for (std::size_t i = 0u; i < commandBuffers.size(); ++i)
+			{
+				const std::size_t rangeSize = std::min(elementsPerBuffer, remainingElementCount);
+				const Iterator rangeEnd = std::next(rangeBegin, static_cast<typename std::iterator_traits<Iterator>::difference_type>(rangeSize));
+
+				commandBuffers[i].Begin(cullBounds);
+				remainingElementCount -= rangeSize;
+
+				if (i == 0u)
+				{
+					firstRangeEnd = rangeEnd;
+				}
+				else if (rangeSize != 0u)
+				{
+					workerTasks.push_back([&commandBuffer = commandBuffers[i], &recordFunction, rangeBegin, rangeEnd]()
+					{
+						recordFunction(commandBuffer, rangeBegin, rangeEnd);
+					});
+				}
+
+				rangeBegin = rangeEnd;
+			}
+
+			Run(std::move(workerTasks), [&commandBuffer = commandBuffers.front(), &recordFunction, begin, firstRangeEnd]()
+			{
+				recordFunction(commandBuffer, begin, firstRangeEnd);
+			});
+		}
+
+		void Run(std::vector<Task>&& workerTasks, const Task& callingThreadTask);
+
+		inline bool IsValid() const noexcept { return m_isRunning; }
+		inline std::size_t GetWorkerCount() const noexcept { return m_workerThreads.size(); }
+
+	private:
+		void ProcessTasks();
+	};
+}
+
+#endif
\ No newline at end of file
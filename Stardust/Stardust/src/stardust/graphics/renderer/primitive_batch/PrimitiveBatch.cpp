@@ -0,0 +1,368 @@
+#include "PrimitiveBatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <utility>
+
+namespace stardust
+{
+	PrimitiveBatch::PrimitiveBatch(const Renderer& renderer, const std::size_t maxVertexCount)
+	{
+		Initialise(renderer, maxVertexCount);
+	}
+
+	PrimitiveBatch::PrimitiveBatch(PrimitiveBatch&& other) noexcept
+		: m_renderer(nullptr), m_maxVertexCount(0u), m_vertices({ }), m_indices({ }), m_isBatching(false), m_drawCallCount(0u)
+	{
+		std::swap(m_renderer, other.m_renderer);
+		std::swap(m_maxVertexCount, other.m_maxVertexCount);
+
+		std::swap(m_vertices, other.m_vertices);
+		std::swap(m_indices, other.m_indices);
+
+		std::swap(m_isBatching, other.m_isBatching);
+		std::swap(m_drawCallCount, other.m_drawCallCount);
+	}
+
+	PrimitiveBatch& PrimitiveBatch::operator =(PrimitiveBatch&& other) noexcept
+	{
+		m_renderer = std::exchange(other.m_renderer, nullptr);
+		m_maxVertexCount = std::exchange(other.m_maxVertexCount, 0u);
+
+		m_vertices = std::exchange(other.m_vertices, { });
+		m_indices = std::exchange(other.m_indices, { });
+
+		m_isBatching = std::exchange(other.m_isBatching, false);
+		m_drawCallCount = std::exchange(other.m_drawCallCount, 0u);
+
+		return *this;
+	}
+
+	PrimitiveBatch::~PrimitiveBatch() noexcept
+	{
+		Destroy();
+	}
+
+	void PrimitiveBatch::Initialise(const Renderer& renderer, const std::size_t maxVertexCount)
+	{
+		m_renderer = &renderer;
+		m_maxVertexCount = maxVertexCount;
+
+		m_vertices = std::vector<Renderer::Vertex>{ };
+		m_vertices.reserve(m_maxVertexCount);
+
+		m_indices = std::vector<int>{ };
+		m_indices.reserve(m_maxVertexCount * 3u / 2u);
+	}
+
+	void PrimitiveBatch::Destroy() noexcept
+	{
+		if (m_renderer != nullptr)
+		{
+			m_renderer = nullptr;
+			m_maxVertexCount = 0u;
+
+			m_vertices.clear();
+			m_indices.clear();
+
+			m_isBatching = false;
+			m_drawCallCount = 0u;
+		}
+	}
+
+	void PrimitiveBatch::Begin()
+	{
+		m_vertices.clear();
+		m_indices.clear();
+
+		m_isBatching = true;
+		m_drawCallCount = 0u;
+	}
+
+	void PrimitiveBatch::DrawPoint(const glm::vec2& point, const Colour& colour)
+	{
+		if (!m_isBatching)
+		{
+			return;
+		}
+
+		ReserveVertices(4u);
+		AddAxisAlignedQuad(point.x, point.y, 1.0f, 1.0f, colour);
+	}
+
+	void PrimitiveBatch::DrawPoints(const std::vector<glm::vec2>& points, const std::vector<Colour>& colours)
+	{
+		const std::size_t pointCount = std::min(points.size(), colours.size());
+
+		for (std::size_t i = 0u; i < pointCount; ++i)
+		{
+			DrawPoint(points[i], colours[i]);
+		}
+	}
+
+	void PrimitiveBatch::DrawLine(const glm::vec2& start, const glm::vec2& end, const Colour& colour, const float thickness)
+	{
+		DrawLine(start, end, colour, colour, thickness);
+	}
+
+	void PrimitiveBatch::DrawLine(const glm::vec2& start, const glm::vec2& end, const Colour& startColour, const Colour& endColour, const float thickness)
+	{
+		if (!m_isBatching)
+		{
+			return;
+		}
+
+		const glm::vec2 direction = end - start;
+		const float length = glm::length(direction);
+
+		if (length == 0.0f)
+		{
+			DrawPoint(start, startColour);
+
+			return;
+		}
+
+		const glm::vec2 normal = glm::vec2{ -direction.y, direction.x } / length * (thickness / 2.0f);
+		const glm::vec2 pixelCentre{ 0.5f, 0.5f };
+
+		ReserveVertices(4u);
+		AddQuad(
+			std::array<glm::vec2, 4u>{ start + pixelCentre + normal, end + pixelCentre + normal, end + pixelCentre - normal, start + pixelCentre - normal },
+			VertexColours{ startColour, endColour, endColour, startColour }
+		);
+	}
+
+	void PrimitiveBatch::DrawConnectedLines(const std::vector<glm::vec2>& points, const Colour& colour, const float thickness)
+	{
+		for (std::size_t i = 1u; i < points.size(); ++i)
+		{
+			DrawLine(points[i - 1u], points[i], colour, thickness);
+		}
+	}
+
+	void PrimitiveBatch::DrawRect(const rect::Rect& rect, const Colour& colour, const Renderer::RectDrawStyle drawStyle)
+	{
+		if (!m_isBatching || rect.w <= 0 || rect.h <= 0)
+		{
+			return;
+		}
+
+		const float x = static_cast<float>(rect.x);
+		const float y = static_cast<float>(rect.y);
+		const float width = static_cast<float>(rect.w);
+		const float height = static_cast<float>(rect.h);
+
+		if (drawStyle == Renderer::RectDrawStyle::Filled || rect.w <= 2 || rect.h <= 2)
+		{
+			ReserveVertices(4u);
+			AddAxisAlignedQuad(x, y, width, height, colour);
+
+			return;
+		}
+
+		ReserveVertices(16u);
+		AddAxisAlignedQuad(x, y, width, 1.0f, colour);
+		AddAxisAlignedQuad(x, y + height - 1.0f, width, 1.0f, colour);
+		AddAxisAlignedQuad(x, y + 1.0f, 1.0f, height - 2.0f, colour);
+		AddAxisAlignedQuad(x + width - 1.0f, y + 1.0f, 1.0f, height - 2.0f, colour);
+	}
+
+	void PrimitiveBatch::DrawRect(const rect::Rect& rect, const VertexColours& vertexColours)
+	{
+		if (!m_isBatching || rect.w <= 0 || rect.h <= 0)
+		{
+			return;
+		}
+
+		const glm::vec2 topLeft{ static_cast<float>(rect.x), static_cast<float>(rect.y) };
+		const glm::vec2 bottomRight{ static_cast<float>(rect.x + rect.w), static_cast<float>(rect.y + rect.h) };
+
+		ReserveVertices(4u);
+		AddQuad(
+			std::array<glm::vec2, 4u>{ topLeft, glm::vec2{ bottomRight.x, topLeft.y }, bottomRight, glm::vec2{ topLeft.x, bottomRight.y } },
+			vertexColours
+		);
+	}
+
+	void PrimitiveBatch::DrawTriangle(const std::array<glm::vec2, 3u>& points, const std::array<Colour, 3u>& colours)
+	{
+		if (!m_isBatching)
+		{
+			return;
+		}
+
+		ReserveVertices(3u);
+
+		for (std::size_t i = 0u; i < points.size(); ++i)
+		{
+			m_indices.push_back(AddVertex(points[i], colours[i]));
+		}
+	}
+
+	void PrimitiveBatch::DrawCircle(const glm::vec2& centre, const float radius, const Colour& colour, const Renderer::RectDrawStyle drawStyle, const unsigned int segmentCount)
+	{
+		if (!m_isBatching || radius <= 0.0f || segmentCount < 3u)
+		{
+			return;
+		}
+
+		const float angleStep = glm::radians(360.0f) / static_cast<float>(segmentCount);
+
+		if (drawStyle == Renderer::RectDrawStyle::Filled)
+		{
+			ReserveVertices(segmentCount + 1u);
+
+			const int centreIndex = AddVertex(centre, colour);
+			const int firstRimIndex = centreIndex + 1;
+
+			for (unsigned int i = 0u; i < segmentCount; ++i)
+			{
+				const float angle = angleStep * static_cast<float>(i);
+				AddVertex(centre + glm::vec2{ std::cos(angle), std::sin(angle) } * radius, colour);
+			}
+
+			for (unsigned int i = 0u; i < segmentCount; ++i)
+			{
+				m_indices.push_back(centreIndex);
+				m_indices.push_back(firstRimIndex + static_cast<int>(i));
+				m_indices.push_back(firstRimIndex + static_cast<int>((i + 1u) % segmentCount));
+			}
+
+			return;
+		}
+
+		const float innerRadius = std::max(radius - 0.5f, 0.0f);
+		const float outerRadius = radius + 0.5f;
+
+		ReserveVertices(segmentCount * 2u);
+
+		const int firstIndex = static_cast<int>(m_vertices.size());
+
+		for (unsigned int i = 0u; i < segmentCount; ++i)
+		{
+			const float angle = angleStep * static_cast<float>(i);
+			const glm::vec2 direction{ std::cos(angle), std::sin(angle) };
+
+			AddVertex(centre + direction * innerRadius, colour);
+			AddVertex(centre + direction * outerRadius, colour);
+		}
+
+		for (unsigned int i = 0u; i < segmentCount; ++i)
+		{
+			const int inner = firstIndex + static_cast<int>(i * 2u);
+			const int outer = inner + 1;
+			const int nextInner = firstIndex + static_cast<int>(((i + 1u) % segmentCount) * 2u);
+			const int nextOuter = nextInner + 1;
+
+			m_indices.push_back(inner);
+			m_indices.push_back(outer);
+			m_indices.push_back(nextOuter);
+			m_indices.push_back(nextOuter);
+			m_indices.push_back(nextInner);
+			m_indices.push_back(inner);
+		}
+	}
+
+	void PrimitiveBatch::DrawPolygon(const std::vector<glm::vec2>& points, const Colour& colour, const Renderer::RectDrawStyle drawStyle)
+	{
+		if (!m_isBatching || points.size() < 3u)
+		{
+			return;
+		}
+
+		if (drawStyle == Renderer::RectDrawStyle::Outline)
+		{
+			DrawConnectedLines(points, colour);
+			DrawLine(points.back(), points.front(), colour);
+
+			return;
+		}
+
+		ReserveVertices(points.size());
+
+		const int firstIndex = static_cast<int>(m_vertices.size());
+
+		for (const auto& point : points)
+		{
+			AddVertex(point, colour);
+		}
+
+		for (int i = 1; i < static_cast<int>(points.size()) - 1; ++i)
+		{
+			m_indices.push_back(firstIndex);
+			m_indices.push_back(firstIndex + i);
+			m_indices.push_back(firstIndex + i + 1);
+		}
+	}
+
+	void PrimitiveBatch::Flush()
+	{
+		if (m_indices.empty())
+		{
+			return;
+		}
+
+		m_renderer->DrawGeometry(
+			std::span<const Renderer::Vertex>(m_vertices.data(), m_vertices.size()),
+			std::span<const int>(m_indices.data(), m_indices.size())
+		);
+
+		m_vertices.clear();
+		m_indices.clear();
+		++m_drawCallCount;
+	}
+
+	void PrimitiveBatch::End()
+	{
+		if (m_isBatching)
+		{
+			Flush();
+			m_isBatching = false;
+		}
+	}
+
+	void PrimitiveBatch::ReserveVertices(const std::size_t vertexCount)
+	{
+		if (m_vertices.size() + vertexCount > m_maxVertexCount)
+		{
+			Flush();
+		}
+	}
+
+	int PrimitiveBatch::AddVertex(const glm::vec2& position, const Colour& colour)
+	{
+		m_vertices.push_back(Renderer::Vertex{
+			.position = SDL_FPoint{ position.x, position.y },
+			.color = colour,
+			.tex_coord = SDL_FPoint{ 0.0f, 0.0f },
+		});
+
+		return static_cast<int>(m_vertices.size() - 1u);
+	}
+
+	void PrimitiveBatch::AddQuad(const std::array<glm::vec2, 4u>& corners, const VertexColours& vertexColours)
+	{
+		const int firstIndex = static_cast<int>(m_vertices.size());
+
+		for (std::size_t i = 0u; i < corners.size(); ++i)
+		{
+			AddVertex(corners[i], vertexColours[i]);
+		}
+
+		m_indices.push_back(firstIndex);
+		m_indices.push_back(firstIndex + 1);
+		m_indices.push_back(firstIndex + 2);
+		m_indices.push_back(firstIndex + 2);
+		m_indices.push_back(firstIndex + 3);
+		m_indices.push_back(firstIndex);
+	}
+
+	void PrimitiveBatch::AddAxisAlignedQuad(const float x, const float y, const float width, const float height, const Colour& colour)
+	{
+		AddQuad(
+			std::array<glm::vec2, 4u>{ glm::vec2{ x, y }, glm::vec2{ x + width, y }, glm::vec2{ x + width, y + height }, glm::vec2{ x, y + height } },
+			VertexColours{ colour, colour, colour, colour }
+		);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+#ifndef PRIMITIVE_BATCH_H
+#define PRIMITIVE_BATCH_H
+
+#include "../../../utility/interfaces/INoncopyable.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../../../rect/Rect.h"
+#include "../../Colour.h"
+#include "../Renderer.h"
+
+namespace stardust
+{
+	class PrimitiveBatch
+		: private INoncopyable
+	{
+	public:
+		using VertexColours = std::array<Colour, 4u>;
+
+	private:
+		static constexpr std::size_t s_DefaultMaxVertexCount = 16'384u;
+		static constexpr unsigned int s_DefaultCircleSegmentCount = 32u;
+
+		const Renderer* m_renderer = nullptr;
+		std::size_t m_maxVertexCount = 0u;
+
+		std::vector<Renderer::Vertex> m_vertices{ };
+		std::vector<int> m_indices{ };
+
+		bool m_isBatching = false;
+		unsigned int m_drawCallCount = 0u;
+
+	public:
+		PrimitiveBatch() = default;
+		explicit PrimitiveBatch(const Renderer& renderer, const std::size_t maxVertexCount = s_DefaultMaxVertexCount);
+
+		PrimitiveBatch(PrimitiveBatch&& other) noexcept;
+		PrimitiveBatch& operator =(PrimitiveBatch&& other) noexcept;
+
+		~PrimitiveBatch() noexcept;
+
+		void Initialise(const Renderer& renderer, const std::size_t maxVertexCount = s_DefaultMaxVertexCount);
+		void Destroy() noexcept;
+
+		void Begin();
+
+		void DrawPoint(const glm::vec2& point, const Colour& colour);
+		void DrawPoints(const std::vector<glm::vec2>& points, const std::vector<Colour>& colours);
+		void DrawLine(const glm::vec2& start, const glm::vec2& end, const Colour& colour, const float thickness = 1.0f);
+		void DrawLine(const glm::vec2& start, const glm::vec2& end, const Colour& startColour, const Colour& endColour, const float thickness = 1.0f);
+		void DrawConnectedLines(const std::vector<glm::vec2>& points, const Colour& colour, const float thickness = 1.0f);
+		void DrawRect(const rect::Rect& rect, const Colour& colour, const Renderer::RectDrawStyle drawStyle = Renderer::RectDrawStyle::Filled);
+		void DrawRect(const rect::Rect& rect, const VertexColours& vertexColours);
+		void DrawTriangle(const std::array<glm::vec2, 3u>& points, const std::array<Colour, 3u>& colours);
+		void DrawCircle(
+			const glm::vec2& centre,
+			const float radius,
+			const Colour& colour,
+			const Renderer::RectDrawStyle drawStyle = Renderer::RectDrawStyle::Filled,
+			const unsigned int segmentCount = s_DefaultCircleSegmentCount
+		);
+		void DrawPolygon(const std::vector<glm::vec2>& points, const Colour& colour, const Renderer::RectDrawStyle drawStyle = Renderer::RectDrawStyle::Filled);
+
+		void Flush();
+		void End();
+
+		inline bool IsValid() const noexcept { return m_renderer != nullptr; }
+		inline bool IsBatching() const noexcept { return m_isBatching; }
+
+		[[nodiscard]] inline const Renderer& GetRenderer() const noexcept { return *m_renderer; }
+		inline std::size_t GetMaxVertexCount() const noexcept { return m_maxVertexCount; }
+		inline std::size_t GetPendingVertexCount() const noexcept { return m_vertices.size(); }
+		inline unsigned int GetDrawCallCount() const noexcept { return m_drawCallCount; }
+
+	private:
+		void ReserveVertices(const std::size_t vertexCount);
+		int AddVertex(const glm::vec2& position, const Colour& colour);
+		void AddQuad(const std::array<glm::vec2, 4u>& corners, const VertexColours& vertexColours);
+		void AddAxisAlignedQuad(const float x, const float y, const float width, const float height, const Colour& colour);
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "RenderLayer.h"
+
+#include <utility>
+
+#include "../../Colour.h"
+
+namespace stardust
+{
+	RenderLayer::RenderLayer(const Renderer& renderer, const glm::uvec2& size)
+	{
+		Initialise(renderer, size);
+	}
+
+	RenderLayer::RenderLayer(RenderLayer&& other) noexcept
+		: m_renderer(nullptr), m_targetTexture(), m_isFullyDirty(true), m_dirtyRegions({ }), m_hasCameraState(false), m_cameraState(CameraState{ }), m_redrawCount(0u)
+	{
+		std::swap(m_renderer, other.m_renderer);
+		std::swap(m_targetTexture, other.m_targetTexture);
+
+		std::swap(m_isFullyDirty, other.m_isFullyDirty);
+		std::swap(m_dirtyRegions, other.m_dirtyRegions);
+
+		std::swap(m_hasCameraState, other.m_hasCameraState);
+		std::swap(m_cameraState, other.m_cameraState);
+
+		std::swap(m_redrawCount, other.m_redrawCount);
+	}
+
+	RenderLayer& RenderLayer::operator =(RenderLayer&& other) noexcept
+	{
+		m_renderer = std::exchange(other.m_renderer, nullptr);
+		m_targetTexture = std::exchange(other.m_targetTexture, Texture());
+
+		m_isFullyDirty = std::exchange(other.m_isFullyDirty, true);
+		m_dirtyRegions = std::exchange(other.m_dirtyRegions, { });
+
+		m_hasCameraState = std::exchange(other.m_hasCameraState, false);
+		m_cameraState = std::exchange(other.m_cameraState, CameraState{ });
+
+		m_redrawCount = std::exchange(other.m_redrawCount, 0u);
+
+		return *this;
+	}
+
+	RenderLayer::~RenderLayer() noexcept
+	{
+		Destroy();
+	}
+
+	void RenderLayer::Initialise(const Renderer& renderer, const glm::uvec2& size)
+	{
+		m_renderer = &renderer;
+
+		if (renderer.CanRenderToTexture())
+		{
+			m_targetTexture.Initialise(renderer, SDL_PIXELFORMAT_RGBA8888, Texture::AccessType::Target, size);
+
+			if (m_targetTexture.IsValid())
+			{
+				m_targetTexture.SetBlendMode(Renderer::GetPremultipliedAlphaBlendMode());
+			}
+		}
+
+		MarkDirty();
+		m_hasCameraState = false;
+	}
+
+	void RenderLayer::Destroy() noexcept
+	{
+		if (m_targetTexture.IsValid())
+		{
+			m_targetTexture.Destroy();
+
+			m_isFullyDirty = true;
+			m_dirtyRegions.clear();
+			m_hasCameraState = false;
+		}
+	}
+
+	void RenderLayer::MarkDirty() const noexcept
+	{
+		m_isFullyDirty = true;
+		m_dirtyRegions.clear();
+	}
+
+	void RenderLayer::MarkDirty(const rect::Rect& region) const
+	{
+		if (m_isFullyDirty)
+		{
+			return;
+		}
+
+		const std::optional<rect::Rect> clippedRegion = rect::GetIntersection(region, rect::Create(0, 0, GetSize().x, GetSize().y));
+
+		if (!clippedRegion.has_value())
+		{
+			return;
+		}
+
+		for (auto& dirtyRegion : m_dirtyRegions)
+		{
+			if (rect::HasIntersection(dirtyRegion, clippedRegion.value()))
+			{
+				dirtyRegion = rect::GetUnion(dirtyRegion, clippedRegion.value());
+
+				return;
+			}
+		}
+
+		if (m_dirtyRegions.size() >= s_MaxDirtyRegionCount)
+		{
+			MarkDirty();
+
+			return;
+		}
+
+		m_dirtyRegions.push_back(clippedRegion.value());
+	}
+
+	void RenderLayer::Draw(const DrawFunction& drawFunction) const
+	{
+		if (!IsValid())
+		{
+			drawFunction(*m_renderer);
+
+			return;
+		}
+
+		if (IsDirty())
+		{
+			Redraw(drawFunction);
+		}
+
+		Composite();
+	}
+
+	void RenderLayer::Draw(const DrawFunction& drawFunction, const Camera& camera) const
+	{
+		const CameraState cameraState{
+			.position = camera.GetPosition(),
+			.rotation = camera.GetRotation(),
+			.zoom = camera.GetZoom(),
+			.halfSize = camera.GetHalfSize(),
+		};
+
+		if (!m_hasCameraState
+			|| m_cameraState.position.x != cameraState.position.x || m_cameraState.position.y != cameraState.position.y
+			|| m_cameraState.rotation != cameraState.rotation || m_cameraState.zoom != cameraState.zoom || m_cameraState.halfSize != cameraState.halfSize)
+		{
+			MarkDirty();
+
+			m_cameraState = cameraState;
+			m_hasCameraState = true;
+		}
+
+		Draw(drawFunction);
+	}
+
+	void RenderLayer::Redraw(const DrawFunction& drawFunction) const
+	{
+		Texture* const previousRenderTarget = m_renderer->GetCurrentRenderTarget();
+		m_renderer->SetCurrentRenderTarget(m_targetTexture);
+
+		if (m_isFullyDirty)
+		{
+			m_renderer->Clear(colours::Clear);
+			drawFunction(*m_renderer);
+		}
+		else
+		{
+			const Renderer::DrawMode previousDrawMode = m_renderer->GetDrawMode();
+			const Renderer::BlendMode previousBlendMode = m_renderer->GetBlendMode();
+
+			for (const auto& dirtyRegion : m_dirtyRegions)
+			{
+				m_renderer->SetClipRect(dirtyRegion);
+
+				m_renderer->SetDrawMode(Renderer::DrawMode::Immediate);
+				m_renderer->SetBlendMode(Renderer::BlendMode::None);
+				m_renderer->DrawRect(dirtyRegion, colours::Clear);
+				m_renderer->SetBlendMode(previousBlendMode);
+				m_renderer->SetDrawMode(previousDrawMode);
+
+				drawFunction(*m_renderer);
+			}
+
+			m_renderer->RemoveClipRect();
+		}
+
+		if (previousRenderTarget != nullptr)
+		{
+			m_renderer->SetCurrentRenderTarget(*previousRenderTarget);
+		}
+		else
+		{
+			m_renderer->ResetRenderTarget();
+		}
+
+		m_isFullyDirty = false;
+		m_dirtyRegions.clear();
+		++m_redrawCount;
+	}
+
+	void RenderLayer::Composite() const
+	{
+		m_renderer->DrawTexture(m_targetTexture, std::nullopt, static_cast<glm::vec2>(GetSize()) / 2.0f, glm::vec2{ 1.0f, 1.0f });
+	}
+}
\ No newline at end of file
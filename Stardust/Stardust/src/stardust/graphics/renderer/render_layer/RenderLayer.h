@@ -0,0 +1,79 @@
+#pragma once
+#ifndef RENDER_LAYER_H
+#define RENDER_LAYER_H
+
+#include "../../../utility/interfaces/INoncopyable.h"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../../../camera/Camera.h"
+#include "../../../rect/Rect.h"
+#include "../../texture/Texture.h"
+#include "../Renderer.h"
+
+namespace stardust
+{
+	class RenderLayer
+		: private INoncopyable
+	{
+	public:
+		using DrawFunction = std::function<void(const Renderer&)>;
+
+	private:
+		struct CameraState
+		{
+			glm::vec2 position;
+			float rotation;
+			float zoom;
+			float halfSize;
+		};
+
+		static constexpr std::size_t s_MaxDirtyRegionCount = 8u;
+
+		const Renderer* m_renderer = nullptr;
+		mutable Texture m_targetTexture;
+
+		mutable bool m_isFullyDirty = true;
+		mutable std::vector<rect::Rect> m_dirtyRegions{ };
+
+		mutable bool m_hasCameraState = false;
+		mutable CameraState m_cameraState{ };
+
+		mutable unsigned int m_redrawCount = 0u;
+
+	public:
+		RenderLayer() = default;
+		RenderLayer(const Renderer& renderer, const glm::uvec2& size);
+
+		RenderLayer(RenderLayer&& other) noexcept;
+		RenderLayer& operator =(RenderLayer&& other) noexcept;
+
+		~RenderLayer() noexcept;
+
+		void Initialise(const Renderer& renderer, const glm::uvec2& size);
+		void Destroy() noexcept;
+
+		void MarkDirty() const noexcept;
+		void MarkDirty(const rect::Rect& region) const;
+		inline bool IsDirty() const noexcept { return m_isFullyDirty || !m_dirtyRegions.empty(); }
+
+		void Draw(const DrawFunction& drawFunction) const;
+		void Draw(const DrawFunction& drawFunction, const Camera& camera) const;
+
+		inline bool IsValid() const noexcept { return m_targetTexture.IsValid(); }
+
+		inline const Texture& GetTexture() const noexcept { return m_targetTexture; }
+		inline const glm::uvec2& GetSize() const noexcept { return m_targetTexture.GetSize(); }
+		inline unsigned int GetRedrawCount() const noexcept { return m_redrawCount; }
+
+	private:
+		void Redraw(const DrawFunction& drawFunction) const;
+		void Composite() const;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,291 @@
+#include "SpriteBatch.h"
+
+#include <cmath>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace stardust
+{
+	SpriteBatch::SpriteBatch(const Renderer& renderer, const std::size_t maxSpriteCount)
+	{
+		Initialise(renderer, maxSpriteCount);
+	}
+
+	SpriteBatch::SpriteBatch(SpriteBatch&& other) noexcept
+		: m_renderer(nullptr), m_maxSpriteCount(0u), m_vertices({ }), m_indices({ }), m_currentTexture(nullptr), m_currentTextureMod(colours::White), m_isBatching(false), m_applyTextureModulation(true), m_drawCallCount(0u)
+	{
+		std::swap(m_renderer, other.m_renderer);
+		std::swap(m_maxSpriteCount, other.m_maxSpriteCount);
+
+		std::swap(m_vertices, other.m_vertices);
+		std::swap(m_indices, other.m_indices);
+
+		std::swap(m_currentTexture, other.m_currentTexture);
+		std::swap(m_currentTextureMod, other.m_currentTextureMod);
+
+		std::swap(m_isBatching, other.m_isBatching);
+		std::swap(m_applyTextureModulation, other.m_applyTextureModulation);
+		std::swap(m_drawCallCount, other.m_drawCallCount);
+	}
+
+	SpriteBatch& SpriteBatch::operator =(SpriteBatch&& other) noexcept
+	{
+		m_renderer = std::exchange(other.m_renderer, nullptr);
+		m_maxSpriteCount = std::exchange(other.m_maxSpriteCount, 0u);
+
+		m_vertices = std::exchange(other.m_vertices, { });
+		m_indices = std::exchange(other.m_indices, { });
+
+		m_currentTexture = std::exchange(other.m_currentTexture, nullptr);
+		m_currentTextureMod = std::exchange(other.m_currentTextureMod, colours::White);
+
+		m_isBatching = std::exchange(other.m_isBatching, false);
+		m_applyTextureModulation = std::exchange(other.m_applyTextureModulation, true);
+		m_drawCallCount = std::exchange(other.m_drawCallCount, 0u);
+
+		return *this;
+	}
+
+	SpriteBatch::~SpriteBatch() noexcept
+	{
+		Destroy();
+	}
+
+	void SpriteBatch::Initialise(const Renderer& renderer, const std::size_t maxSpriteCount)
+	{
+		m_renderer = &renderer;
+		m_maxSpriteCount = maxSpriteCount;
+
+		m_vertices = std::vector<Renderer::Vertex>{ };
+		m_vertices.reserve(m_maxSpriteCount * s_VerticesPerSprite);
+
+		m_indices = std::vector<int>{ };
+		m_indices.reserve(m_maxSpriteCount * s_IndicesPerSprite);
+
+		for (std::size_t i = 0u; i < m_maxSpriteCount; ++i)
+		{
+			const int firstVertex = static_cast<int>(i * s_VerticesPerSprite);
+
+			m_indices.push_back(firstVertex);
+			m_indices.push_back(firstVertex + 1);
+			m_indices.push_back(firstVertex + 2);
+			m_indices.push_back(firstVertex + 2);
+			m_indices.push_back(firstVertex + 3);
+			m_indices.push_back(firstVertex);
+		}
+	}
+
+	void SpriteBatch::Destroy() noexcept
+	{
+		if (m_renderer != nullptr)
+		{
+			m_renderer = nullptr;
+			m_maxSpriteCount = 0u;
+
+			m_vertices.clear();
+			m_indices.clear();
+
+			m_currentTexture = nullptr;
+			m_currentTextureMod = colours::White;
+
+			m_isBatching = false;
+			m_applyTextureModulation = true;
+			m_drawCallCount = 0u;
+		}
+	}
+
+	void SpriteBatch::Begin(const bool applyTextureModulation)
+	{
+		m_vertices.clear();
+		m_currentTexture = nullptr;
+
+		m_isBatching = true;
+		m_applyTextureModulation = applyTextureModulation;
+		m_drawCallCount = 0u;
+	}
+
+	void SpriteBatch::Draw(const Sprite& sprite)
+	{
+		if (!m_isBatching || sprite.texture == nullptr)
+		{
+			return;
+		}
+
+		if (sprite.texture != m_currentTexture)
+		{
+			Flush();
+			SetCurrentTexture(*sprite.texture);
+		}
+		else
+		{
+			if (GetPendingSpriteCount() >= m_maxSpriteCount)
+			{
+				Flush();
+			}
+
+			if (m_applyTextureModulation)
+			{
+				m_currentTextureMod = GetTextureMod(*sprite.texture);
+			}
+		}
+
+		AppendSpriteVertices(sprite, m_currentTextureMod, m_vertices);
+	}
+
+	void SpriteBatch::Draw(const Texture& texture, const std::optional<rect::Rect>& sourceRect, const glm::vec2& position, const glm::vec2& scale, const Colour& colour)
+	{
+		Draw(Sprite{
+			.texture = &texture,
+			.sourceRect = sourceRect,
+			.position = position,
+			.scale = scale,
+			.vertexColours = VertexColours{ colour, colour, colour, colour },
+		});
+	}
+
+	void SpriteBatch::DrawRotated(
+		const Texture& texture,
+		const std::optional<rect::Rect>& sourceRect,
+		const glm::vec2& position,
+		const glm::vec2& scale,
+		const float angle,
+		const glm::uvec2& rotationOffset,
+		const Renderer::FlipAxis flipAxis,
+		const Colour& colour
+	)
+	{
+		Draw(Sprite{
+			.texture = &texture,
+			.sourceRect = sourceRect,
+			.position = position,
+			.scale = scale,
+			.angle = angle,
+			.rotationOffset = rotationOffset,
+			.flipAxis = flipAxis,
+			.vertexColours = VertexColours{ colour, colour, colour, colour },
+		});
+	}
+
+	void SpriteBatch::End()
+	{
+		if (m_isBatching)
+		{
+			Flush();
+
+			m_currentTexture = nullptr;
+			m_isBatching = false;
+		}
+	}
+
+	void SpriteBatch::Flush()
+	{
+		if (m_vertices.empty() || m_currentTexture == nullptr)
+		{
+			return;
+		}
+
+		const std::size_t spriteCount = GetPendingSpriteCount();
+
+		m_renderer->DrawGeometry(
+			std::span<const Renderer::Vertex>(m_vertices.data(), m_vertices.size()),
+			std::span<const int>(m_indices.data(), spriteCount * s_IndicesPerSprite),
+			m_currentTexture
+		);
+
+		m_vertices.clear();
+		++m_drawCallCount;
+	}
+
+	[[nodiscard]] Colour SpriteBatch::GetTextureMod(const Texture& texture) noexcept
+	{
+		const auto [red, green, blue] = texture.GetColourMod();
+
+		return Colour{ red, green, blue, texture.GetAlphaMod() };
+	}
+
+	void SpriteBatch::AppendSpriteVertices(const Sprite& sprite, const Colour& textureMod, std::vector<Renderer::Vertex>& out_vertices)
+	{
+		const glm::vec2 textureSize = sprite.texture->GetSize();
+		const rect::Rect sourceRect = sprite.sourceRect.has_value()
+			? sprite.sourceRect.value()
+			: rect::Create(0, 0, sprite.texture->GetSize().x, sprite.texture->GetSize().y);
+
+		const glm::vec2 spriteSize{
+			sourceRect.w * sprite.scale.x,
+			sourceRect.h * sprite.scale.y,
+		};
+
+		const rect::Rect destinationRect = rect::Create(
+			static_cast<int>(sprite.position.x - spriteSize.x / 2.0f),
+			static_cast<int>(sprite.position.y - spriteSize.y / 2.0f),
+			static_cast<unsigned int>(spriteSize.x),
+			static_cast<unsigned int>(spriteSize.y)
+		);
+
+		const glm::vec2 centrePoint{
+			static_cast<float>(destinationRect.x) + static_cast<float>(destinationRect.w / 2 + static_cast<int>(sprite.rotationOffset.x)),
+			static_cast<float>(destinationRect.y) + static_cast<float>(destinationRect.h / 2 + static_cast<int>(sprite.rotationOffset.y)),
+		};
+
+		const std::array<glm::vec2, s_VerticesPerSprite> corners{
+			glm::vec2{ static_cast<float>(destinationRect.x), static_cast<float>(destinationRect.y) },
+			glm::vec2{ static_cast<float>(destinationRect.x + destinationRect.w), static_cast<float>(destinationRect.y) },
+			glm::vec2{ static_cast<float>(destinationRect.x + destinationRect.w), static_cast<float>(destinationRect.y + destinationRect.h) },
+			glm::vec2{ static_cast<float>(destinationRect.x), static_cast<float>(destinationRect.y + destinationRect.h) },
+		};
+
+		float minU = static_cast<float>(sourceRect.x) / textureSize.x;
+		float maxU = static_cast<float>(sourceRect.x + sourceRect.w) / textureSize.x;
+		float minV = static_cast<float>(sourceRect.y) / textureSize.y;
+		float maxV = static_cast<float>(sourceRect.y + sourceRect.h) / textureSize.y;
+
+		if (static_cast<int>(sprite.flipAxis) & static_cast<int>(Renderer::FlipAxis::Horizontal))
+		{
+			std::swap(minU, maxU);
+		}
+
+		if (static_cast<int>(sprite.flipAxis) & static_cast<int>(Renderer::FlipAxis::Vertical))
+		{
+			std::swap(minV, maxV);
+		}
+
+		const std::array<glm::vec2, s_VerticesPerSprite> textureCoordinates{
+			glm::vec2{ minU, minV },
+			glm::vec2{ maxU, minV },
+			glm::vec2{ maxU, maxV },
+			glm::vec2{ minU, maxV },
+		};
+
+		const float angleRadians = glm::radians(sprite.angle);
+		const float sine = std::sin(angleRadians);
+		const float cosine = std::cos(angleRadians);
+
+		for (std::size_t i = 0u; i < s_VerticesPerSprite; ++i)
+		{
+			const glm::vec2 relativeCorner = corners[i] - centrePoint;
+			const Colour& vertexColour = sprite.vertexColours[i];
+
+			out_vertices.push_back(Renderer::Vertex{
+				.position = SDL_FPoint{
+					cosine * relativeCorner.x - sine * relativeCorner.y + centrePoint.x,
+					sine * relativeCorner.x + cosine * relativeCorner.y + centrePoint.y,
+				},
+				.color = Colour{
+					static_cast<std::uint8_t>(vertexColour.r * textureMod.r / 255u),
+					static_cast<std::uint8_t>(vertexColour.g * textureMod.g / 255u),
+					static_cast<std::uint8_t>(vertexColour.b * textureMod.b / 255u),
+					static_cast<std::uint8_t>(vertexColour.a * textureMod.a / 255u),
+				},
+				.tex_coord = SDL_FPoint{ textureCoordinates[i].x, textureCoordinates[i].y },
+			});
+		}
+	}
+
+	void SpriteBatch::SetCurrentTexture(const Texture& texture)
+	{
+		m_currentTexture = &texture;
+
+		m_currentTextureMod = m_applyTextureModulation ? GetTextureMod(texture) : colours::White;
+	}
+}
\ No newline at end of file
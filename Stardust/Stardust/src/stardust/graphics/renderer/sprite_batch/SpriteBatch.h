@@ -0,0 +1,104 @@
+#pragma once
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include "../../../utility/interfaces/INoncopyable.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../../../rect/Rect.h"
+#include "../../Colour.h"
+#include "../../texture/Texture.h"
+#include "../Renderer.h"
+
+namespace stardust
+{
+	class SpriteBatch
+		: private INoncopyable
+	{
+	public:
+		using VertexColours = std::array<Colour, 4u>;
+
+		struct Sprite
+		{
+			const Texture* texture;
+			std::optional<rect::Rect> sourceRect = std::nullopt;
+
+			glm::vec2 position{ 0.0f, 0.0f };
+			glm::vec2 scale{ 1.0f, 1.0f };
+
+			float angle = 0.0f;
+			glm::uvec2 rotationOffset{ 0u, 0u };
+			Renderer::FlipAxis flipAxis = Renderer::FlipAxis::None;
+
+			VertexColours vertexColours{ colours::White, colours::White, colours::White, colours::White };
+		};
+
+	private:
+		static constexpr std::size_t s_DefaultMaxSpriteCount = 4'096u;
+		static constexpr std::size_t s_VerticesPerSprite = 4u;
+		static constexpr std::size_t s_IndicesPerSprite = 6u;
+
+		const Renderer* m_renderer = nullptr;
+		std::size_t m_maxSpriteCount = 0u;
+
+		std::vector<Renderer::Vertex> m_vertices{ };
+		std::vector<int> m_indices{ };
+
+		const Texture* m_currentTexture = nullptr;
+		Colour m_currentTextureMod = colours::White;
+
+		bool m_isBatching = false;
+		bool m_applyTextureModulation = true;
+		unsigned int m_drawCallCount = 0u;
+
+	public:
+		SpriteBatch() = default;
+		explicit SpriteBatch(const Renderer& renderer, const std::size_t maxSpriteCount = s_DefaultMaxSpriteCount);
+
+		SpriteBatch(SpriteBatch&& other) noexcept;
+		SpriteBatch& operator =(SpriteBatch&& other) noexcept;
+
+		~SpriteBatch() noexcept;
+
+		void Initialise(const Renderer& renderer, const std::size_t maxSpriteCount = s_DefaultMaxSpriteCount);
+		void Destroy() noexcept;
+
+		void Begin(const bool applyTextureModulation = true);
+		void Draw(const Sprite& sprite);
+		void Draw(const Texture& texture, const std::optional<rect::Rect>& sourceRect, const glm::vec2& position, const glm::vec2& scale, const Colour& colour = colours::White);
+		void DrawRotated(
+			const Texture& texture,
+			const std::optional<rect::Rect>& sourceRect,
+			const glm::vec2& position,
+			const glm::vec2& scale,
+			const float angle,
+			const glm::uvec2& rotationOffset = glm::uvec2{ 0u, 0u },
+			const Renderer::FlipAxis flipAxis = Renderer::FlipAxis::None,
+			const Colour& colour = colours::White
+		);
+		void Flush();
+		void End();
+
+		[[nodiscard]] static Colour GetTextureMod(const Texture& texture) noexcept;
+		static void AppendSpriteVertices(const Sprite& sprite, const Colour& textureMod, std::vector<Renderer::Vertex>& out_vertices);
+
+		inline bool IsValid() const noexcept { return m_renderer != nullptr; }
+		inline bool IsBatching() const noexcept { return m_isBatching; }
+
+		inline std::size_t GetMaxSpriteCount() const noexcept { return m_maxSpriteCount; }
+		inline std::size_t GetPendingSpriteCount() const noexcept { return m_vertices.size() / s_VerticesPerSprite; }
+		inline unsigned int GetDrawCallCount() const noexcept { return m_drawCallCount; }
+
+	private:
+		void SetCurrentTexture(const Texture& texture);
+	};
+}
+
+#endif
\ No newline at end of file
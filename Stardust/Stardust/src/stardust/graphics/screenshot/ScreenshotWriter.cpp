@@ -0,0 +1,169 @@
+#include "ScreenshotWriter.h"
+
+#include <chrono>
+#include <utility>
+
+#include <stb/stb_image_write.h>
+
+#include "../../debug/logging/Log.h"
+
+namespace stardust
+{
+	ScreenshotWriter::ScreenshotWriter(const std::string_view& directory, const std::size_t captureBufferCount)
+	{
+		Initialise(directory, captureBufferCount);
+	}
+
+	ScreenshotWriter::~ScreenshotWriter() noexcept
+	{
+		Destroy();
+	}
+
+	void ScreenshotWriter::Initialise(const std::string_view& directory, const std::size_t captureBufferCount)
+	{
+		Destroy();
+
+		m_directory = directory;
+
+		m_captureBuffers = std::vector<PixelSurface>(captureBufferCount);
+		m_freeCaptureBufferIndices.clear();
+		m_freeCaptureBufferIndices.reserve(captureBufferCount);
+
+		for (std::size_t i = 0u; i < captureBufferCount; ++i)
+		{
+			m_freeCaptureBufferIndices.push_back(captureBufferCount - i - 1u);
+		}
+
+		m_isStopping = false;
+		m_workerThread = std::thread(&ScreenshotWriter::ProcessEncodeJobs, this);
+	}
+
+	void ScreenshotWriter::Destroy() noexcept
+	{
+		if (m_workerThread.joinable())
+		{
+			{
+				const std::scoped_lock<std::mutex> lock(m_mutex);
+				m_isStopping = true;
+			}
+
+			m_jobCondition.notify_all();
+			m_workerThread.join();
+
+			m_captureBuffers.clear();
+			m_freeCaptureBufferIndices.clear();
+			m_encodeJobs.clear();
+			m_completedCaptures.clear();
+
+			m_pendingCaptureCount = 0u;
+			m_captureSequence = 0u;
+			m_droppedCaptureCount = 0u;
+		}
+	}
+
+	void ScreenshotWriter::RequestCapture(const unsigned int frameCount) noexcept
+	{
+		m_pendingCaptureCount += frameCount;
+	}
+
+	void ScreenshotWriter::CapturePendingFrame(const Renderer& renderer)
+	{
+		if (m_pendingCaptureCount == 0u || !IsValid())
+		{
+			return;
+		}
+
+		--m_pendingCaptureCount;
+
+		const unsigned long long currentTime = static_cast<unsigned long long>(std::chrono::system_clock::now().time_since_epoch().count());
+		std::string screenshotFilename = m_directory + "/screenshot_" + std::to_string(currentTime) + "_" + std::to_string(m_captureSequence++) + ".png";
+
+		std::size_t captureBufferIndex = 0u;
+
+		{
+			const std::scoped_lock<std::mutex> lock(m_mutex);
+
+			if (m_freeCaptureBufferIndices.empty())
+			{
+				++m_droppedCaptureCount;
+				Log::EngineWarn("Screenshot capture buffers are full; dropping frame.");
+
+				return;
+			}
+
+			captureBufferIndex = m_freeCaptureBufferIndices.back();
+			m_freeCaptureBufferIndices.pop_back();
+		}
+
+		if (renderer.ReadPixels(m_captureBuffers[captureBufferIndex]) == Status::Fail)
+		{
+			const std::scoped_lock<std::mutex> lock(m_mutex);
+
+			m_freeCaptureBufferIndices.push_back(captureBufferIndex);
+			m_completedCaptures.push_back(CaptureResult{
+				.filepath = std::move(screenshotFilename),
+				.wasSuccessful = false,
+			});
+
+			return;
+		}
+
+		{
+			const std::scoped_lock<std::mutex> lock(m_mutex);
+
+			m_encodeJobs.push_back(EncodeJob{
+				.captureBufferIndex = captureBufferIndex,
+				.filepath = std::move(screenshotFilename),
+			});
+		}
+
+		m_jobCondition.notify_one();
+	}
+
+	[[nodiscard]] std::vector<ScreenshotWriter::CaptureResult> ScreenshotWriter::GetCompletedCaptures()
+	{
+		std::vector<CaptureResult> completedCaptures{ };
+
+		{
+			const std::scoped_lock<std::mutex> lock(m_mutex);
+			std::swap(completedCaptures, m_completedCaptures);
+		}
+
+		return completedCaptures;
+	}
+
+	void ScreenshotWriter::ProcessEncodeJobs()
+	{
+		while (true)
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_jobCondition.wait(lock, [this]() { return m_isStopping || !m_encodeJobs.empty(); });
+
+			if (m_encodeJobs.empty())
+			{
+				return;
+			}
+
+			EncodeJob encodeJob = std::move(m_encodeJobs.front());
+			m_encodeJobs.pop_front();
+			lock.unlock();
+
+			const PixelSurface& pixelData = m_captureBuffers[encodeJob.captureBufferIndex];
+			const bool wasSuccessful = stbi_write_png(
+				encodeJob.filepath.c_str(),
+				static_cast<int>(pixelData.GetSize().x),
+				static_cast<int>(pixelData.GetSize().y),
+				static_cast<int>(pixelData.GetPitch() / pixelData.GetSize().x),
+				pixelData.GetPixels(),
+				static_cast<int>(pixelData.GetPitch())
+			) != 0;
+
+			lock.lock();
+			m_freeCaptureBufferIndices.push_back(encodeJob.captureBufferIndex);
+			m_completedCaptures.push_back(CaptureResult{
+				.filepath = std::move(encodeJob.filepath),
+				.wasSuccessful = wasSuccessful,
+			});
+		}
+	}
+}
\ No newline at end of file
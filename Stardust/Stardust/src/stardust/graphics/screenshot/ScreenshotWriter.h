@@ -0,0 +1,81 @@
+#pragma once
+#ifndef SCREENSHOT_WRITER_H
+#define SCREENSHOT_WRITER_H
+
+#include "../../utility/interfaces/INoncopyable.h"
+#include "../../utility/interfaces/INonmovable.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../renderer/Renderer.h"
+#include "../surface/PixelSurface.h"
+
+namespace stardust
+{
+	class ScreenshotWriter
+		: private INoncopyable, private INonmovable
+	{
+	public:
+		struct CaptureResult
+		{
+			std::string filepath;
+			bool wasSuccessful;
+		};
+
+		static constexpr std::size_t s_DefaultCaptureBufferCount = 8u;
+
+	private:
+		struct EncodeJob
+		{
+			std::size_t captureBufferIndex;
+			std::string filepath;
+		};
+
+		std::string m_directory;
+
+		std::vector<PixelSurface> m_captureBuffers{ };
+		std::vector<std::size_t> m_freeCaptureBufferIndices{ };
+		std::deque<EncodeJob> m_encodeJobs{ };
+		std::vector<CaptureResult> m_completedCaptures{ };
+
+		std::mutex m_mutex;
+		std::condition_variable m_jobCondition;
+		std::thread m_workerThread;
+		bool m_isStopping = false;
+
+		unsigned int m_pendingCaptureCount = 0u;
+		unsigned int m_captureSequence = 0u;
+		unsigned int m_droppedCaptureCount = 0u;
+
+	public:
+		ScreenshotWriter() = default;
+		ScreenshotWriter(const std::string_view& directory, const std::size_t captureBufferCount = s_DefaultCaptureBufferCount);
+		~ScreenshotWriter() noexcept;
+
+		void Initialise(const std::string_view& directory, const std::size_t captureBufferCount = s_DefaultCaptureBufferCount);
+		void Destroy() noexcept;
+
+		void RequestCapture(const unsigned int frameCount = 1u) noexcept;
+		void CapturePendingFrame(const Renderer& renderer);
+
+		[[nodiscard]] std::vector<CaptureResult> GetCompletedCaptures();
+
+		inline bool IsValid() const noexcept { return m_workerThread.joinable(); }
+		inline bool IsCapturePending() const noexcept { return m_pendingCaptureCount > 0u; }
+
+		inline std::size_t GetCaptureBufferCount() const noexcept { return m_captureBuffers.size(); }
+		inline unsigned int GetDroppedCaptureCount() const noexcept { return m_droppedCaptureCount; }
+
+	private:
+		void ProcessEncodeJobs();
+	};
+}
+
+#endif
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <stb/stb_image.h>
 
 #include "../../vfs/VFS.h"
+#include "cooked_texture/CookedTexture.h"
 
 namespace stardust
 {
@@ -31,7 +32,8 @@ namespace stardust
 	}
 
 	Texture::Texture(Texture&& other) noexcept
-		: m_renderer(nullptr), m_handle(nullptr), m_size(glm::uvec2{ 0u, 0u }), m_format(0u), m_accessType(AccessType::Static), m_isLocked(false)
+		: m_renderer(nullptr), m_handle(nullptr), m_size(glm::uvec2{ 0u, 0u }), m_format(0u), m_accessType(AccessType::Static), m_isLocked(false),
+		  m_modulation(colours::White), m_appliedModulation(colours::White), m_blendMode(Renderer::BlendMode::None), m_appliedBlendMode(Renderer::BlendMode::None)
 	{
 		std::swap(m_renderer, other.m_renderer);
 		std::swap(m_handle, other.m_handle);
@@ -41,6 +43,11 @@ namespace stardust
 		std::swap(m_accessType, other.m_accessType);
 
 		std::swap(m_isLocked, other.m_isLocked);
+
+		std::swap(m_modulation, other.m_modulation);
+		std::swap(m_appliedModulation, other.m_appliedModulation);
+		std::swap(m_blendMode, other.m_blendMode);
+		std::swap(m_appliedBlendMode, other.m_appliedBlendMode);
 	}
 
 	Texture& Texture::operator =(Texture&& other) noexcept
@@ -54,6 +61,11 @@ namespace stardust
 
 		m_isLocked = std::exchange(other.m_isLocked, false);
 
+		m_modulation = std::exchange(other.m_modulation, colours::White);
+		m_appliedModulation = std::exchange(other.m_appliedModulation, colours::White);
+		m_blendMode = std::exchange(other.m_blendMode, Renderer::BlendMode::None);
+		m_appliedBlendMode = std::exchange(other.m_appliedBlendMode, Renderer::BlendMode::None);
+
 		return *this;
 	}
 
@@ -64,17 +76,24 @@ namespace stardust
 
 	void Texture::Initialise(const Renderer& renderer, const std::string_view& filepath)
 	{
-		const std::vector<std::byte> rawTextureData = vfs::ReadFileData(filepath);
+		const vfs::FileView rawTextureData = vfs::ReadFileView(filepath);
 
-		if (rawTextureData.empty())
+		if (rawTextureData.IsEmpty())
 		{
 			return;
 		}
 
+		if (cooked_texture::IsCookedTextureData(rawTextureData.GetBytes()))
+		{
+			InitialiseFromCookedData(renderer, rawTextureData.GetBytes());
+
+			return;
+		}
+
 		int width = 0;
 		int height = 0;
 		int channelCount = 0;
-		stbi_uc* textureData = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(rawTextureData.data()), static_cast<int>(rawTextureData.size()), &width, &height, &channelCount, STBI_default);
+		stbi_uc* textureData = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(rawTextureData.GetData()), static_cast<int>(rawTextureData.GetSize()), &width, &height, &channelCount, STBI_default);
 
 		if (textureData == nullptr)
 		{
@@ -111,6 +130,29 @@ namespace stardust
 			int accessType = 0;
 			SDL_QueryTexture(GetRawHandle(), &m_format, &accessType, nullptr, nullptr);
 			m_accessType = static_cast<AccessType>(accessType);
+
+			SynchroniseModulation();
+		}
+	}
+
+	void Texture::InitialiseFromCookedData(const Renderer& renderer, const std::span<const std::byte> cookedTextureData)
+	{
+		glm::uvec2 size{ 0u, 0u };
+		std::vector<std::byte> pixels{ };
+
+		if (cooked_texture::Decode(cookedTextureData, size, pixels) == Status::Fail)
+		{
+			return;
+		}
+
+		Initialise(renderer, SDL_PIXELFORMAT_RGBA32, AccessType::Static, size);
+
+		if (m_handle != nullptr)
+		{
+			SDL_UpdateTexture(GetRawHandle(), nullptr, pixels.data(), static_cast<int>(size.x * 4u));
+			SDL_SetTextureBlendMode(GetRawHandle(), SDL_BLENDMODE_BLEND);
+
+			SynchroniseModulation();
 		}
 	}
 
@@ -126,6 +168,8 @@ namespace stardust
 			int accessType = 0;
 			SDL_QueryTexture(GetRawHandle(), &m_format, &accessType, nullptr, nullptr);
 			m_accessType = static_cast<AccessType>(accessType);
+
+			SynchroniseModulation();
 		}
 	}
 
@@ -148,6 +192,8 @@ namespace stardust
 			m_size = size;
 			m_format = format;
 			m_accessType = accessType;
+
+			SynchroniseModulation();
 		}
 	}
 
@@ -211,45 +257,73 @@ namespace stardust
 		SDL_SetTextureScaleMode(GetRawHandle(), static_cast<SDL_ScaleMode>(scaleMode));
 	}
 
-	[[nodiscard]] Renderer::BlendMode Texture::GetBlendMode() const noexcept
+	void Texture::SetBlendMode(const Renderer::BlendMode blendMode) const noexcept
 	{
-		SDL_BlendMode blendMode = SDL_BLENDMODE_INVALID;
-		SDL_GetTextureBlendMode(GetRawHandle(), &blendMode);
+		if (m_blendMode == blendMode && m_renderer != nullptr)
+		{
+			m_renderer->RecordStateChange(m_renderer->m_statistics.textureModChanges, true);
+		}
 
-		return static_cast<Renderer::BlendMode>(blendMode);
+		m_blendMode = blendMode;
 	}
 
-	void Texture::SetBlendMode(const Renderer::BlendMode blendMode) const noexcept
+	void Texture::SetAlphaMod(const std::uint8_t alphaMod) const noexcept
 	{
-		SDL_SetTextureBlendMode(GetRawHandle(), static_cast<SDL_BlendMode>(blendMode));
+		if (m_modulation.a == alphaMod && m_renderer != nullptr)
+		{
+			m_renderer->RecordStateChange(m_renderer->m_statistics.textureModChanges, true);
+		}
+
+		m_modulation.a = alphaMod;
 	}
 
-	[[nodiscard]] std::uint8_t Texture::GetAlphaMod() const noexcept
+	void Texture::SetColourMod(const std::uint8_t red, const std::uint8_t green, const std::uint8_t blue) const noexcept
 	{
-		std::uint8_t alphaMod = 0u;
-		SDL_GetTextureAlphaMod(GetRawHandle(), &alphaMod);
+		if (m_modulation.r == red && m_modulation.g == green && m_modulation.b == blue && m_renderer != nullptr)
+		{
+			m_renderer->RecordStateChange(m_renderer->m_statistics.textureModChanges, true);
+		}
 
-		return alphaMod;
+		m_modulation.r = red;
+		m_modulation.g = green;
+		m_modulation.b = blue;
 	}
 
-	void Texture::SetAlphaMod(const std::uint8_t alphaMod) const noexcept
-	{
-		SDL_SetTextureAlphaMod(GetRawHandle(), alphaMod);
-	}
-	
-	[[nodiscard]] std::tuple<std::uint8_t, std::uint8_t, std::uint8_t> Texture::GetColourMod() const noexcept
+	void Texture::SynchroniseModulation() noexcept
 	{
-		std::uint8_t red = 0u;
-		std::uint8_t green = 0u;
-		std::uint8_t blue = 0u;
-
-		SDL_GetTextureColorMod(GetRawHandle(), &red, &green, &blue);
+		SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+		SDL_GetTextureBlendMode(GetRawHandle(), &blendMode);
+		m_blendMode = static_cast<Renderer::BlendMode>(blendMode);
+		m_appliedBlendMode = m_blendMode;
 
-		return { red, green, blue };
+		SDL_GetTextureColorMod(GetRawHandle(), &m_modulation.r, &m_modulation.g, &m_modulation.b);
+		SDL_GetTextureAlphaMod(GetRawHandle(), &m_modulation.a);
+		m_appliedModulation = m_modulation;
 	}
 
-	void Texture::SetColourMod(const std::uint8_t red, const std::uint8_t green, const std::uint8_t blue) const noexcept
+	void Texture::ApplyPendingModulation() const noexcept
 	{
-		SDL_SetTextureColorMod(GetRawHandle(), red, green, blue);
+		if (m_appliedBlendMode != m_blendMode)
+		{
+			SDL_SetTextureBlendMode(GetRawHandle(), static_cast<SDL_BlendMode>(m_blendMode));
+			m_appliedBlendMode = m_blendMode;
+			m_renderer->RecordStateChange(m_renderer->m_statistics.textureModChanges, false);
+		}
+
+		if (m_appliedModulation.r != m_modulation.r || m_appliedModulation.g != m_modulation.g || m_appliedModulation.b != m_modulation.b)
+		{
+			SDL_SetTextureColorMod(GetRawHandle(), m_modulation.r, m_modulation.g, m_modulation.b);
+			m_appliedModulation.r = m_modulation.r;
+			m_appliedModulation.g = m_modulation.g;
+			m_appliedModulation.b = m_modulation.b;
+			m_renderer->RecordStateChange(m_renderer->m_statistics.textureModChanges, false);
+		}
+
+		if (m_appliedModulation.a != m_modulation.a)
+		{
+			SDL_SetTextureAlphaMod(GetRawHandle(), m_modulation.a);
+			m_appliedModulation.a = m_modulation.a;
+			m_renderer->RecordStateChange(m_renderer->m_statistics.textureModChanges, false);
+		}
 	}
 }
\ No newline at end of file
@@ -4,17 +4,21 @@
 
 #include "../../utility/interfaces/INoncopyable.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <glm/glm.hpp>
 #include <SDL2/SDL.h>
 
 #include "../../rect/Rect.h"
+#include "../Colour.h"
 #include "../renderer/Renderer.h"
 
 namespace stardust
@@ -54,6 +58,11 @@ namespace stardust
 
 		bool m_isLocked = false;
 
+		mutable Colour m_modulation = colours::White;
+		mutable Colour m_appliedModulation = colours::White;
+		mutable Renderer::BlendMode m_blendMode = Renderer::BlendMode::None;
+		mutable Renderer::BlendMode m_appliedBlendMode = Renderer::BlendMode::None;
+
 	public:
 		Texture() = default;
 		Texture(const Renderer& renderer, const std::string_view& filepath);
@@ -83,18 +92,27 @@ namespace stardust
 		inline const glm::uvec2& GetSize() const noexcept { return m_size; }
 		inline std::uint32_t GetFormat() const noexcept { return m_format; }
 		inline AccessType GetAccessType() const noexcept { return m_accessType; }
+		inline std::size_t GetMemoryUsage() const noexcept { return static_cast<std::size_t>(m_size.x) * static_cast<std::size_t>(m_size.y) * SDL_BYTESPERPIXEL(m_format); }
 
 		[[nodiscard]] ScaleMode GetScaleMode() const noexcept;
 		void SetScaleMode(const ScaleMode scaleMode) const noexcept;
 
-		[[nodiscard]] Renderer::BlendMode GetBlendMode() const noexcept;
+		inline Renderer::BlendMode GetBlendMode() const noexcept { return m_blendMode; }
 		void SetBlendMode(const Renderer::BlendMode blendMode) const noexcept;
 
-		[[nodiscard]] std::uint8_t GetAlphaMod() const noexcept;
+		inline std::uint8_t GetAlphaMod() const noexcept { return m_modulation.a; }
 		void SetAlphaMod(const std::uint8_t alphaMod) const noexcept;
 
-		[[nodiscard]] std::tuple<std::uint8_t, std::uint8_t, std::uint8_t> GetColourMod() const noexcept;
+		inline std::tuple<std::uint8_t, std::uint8_t, std::uint8_t> GetColourMod() const noexcept { return { m_modulation.r, m_modulation.g, m_modulation.b }; }
 		void SetColourMod(const std::uint8_t red, const std::uint8_t green, const std::uint8_t blue) const noexcept;
+
+	private:
+		friend class Renderer;
+
+		void InitialiseFromCookedData(const Renderer& renderer, const std::span<const std::byte> cookedTextureData);
+
+		void SynchroniseModulation() noexcept;
+		void ApplyPendingModulation() const noexcept;
 	};
 }
 
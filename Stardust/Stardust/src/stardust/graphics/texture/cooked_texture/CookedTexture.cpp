@@ -0,0 +1,280 @@
+#include "CookedTexture.h"
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+
+#include <lz4.h>
+#include <lz4hc.h>
+#include <stb/stb_image.h>
+
+#include "../../../debug/logging/Log.h"
+#include "../../../utility/binary/Binary.h"
+#include "../texture_atlas/TextureAtlas.h"
+
+namespace stardust
+{
+	namespace cooked_texture
+	{
+		namespace
+		{
+			constexpr std::array<char, 4u> FileMagic{ 'S', 'D', 'T', 'X' };
+			constexpr std::uint16_t FileVersion = 1u;
+			constexpr std::size_t HeaderSize = 28u;
+			constexpr std::size_t BytesPerPixel = 4u;
+			constexpr std::size_t MaxPaletteSize = 256u;
+
+			struct Header
+			{
+				std::uint16_t version;
+				PixelFormat pixelFormat;
+				std::uint32_t width;
+				std::uint32_t height;
+				std::uint32_t paletteSize;
+				std::uint32_t uncompressedSize;
+				std::uint32_t compressedSize;
+			};
+
+			[[nodiscard]] Header ReadHeader(const std::span<const std::byte> fileData)
+			{
+				std::size_t offset = FileMagic.size();
+
+				const std::uint16_t version = static_cast<std::uint16_t>(binary::ReadLittleEndian(fileData, offset, sizeof(std::uint16_t)));
+				const PixelFormat pixelFormat = static_cast<PixelFormat>(binary::ReadLittleEndian(fileData, offset, sizeof(std::uint8_t)));
+				offset += sizeof(std::uint8_t);
+
+				const std::uint32_t width = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint32_t));
+				const std::uint32_t height = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint32_t));
+				const std::uint32_t paletteSize = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint32_t));
+				const std::uint32_t uncompressedSize = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint32_t));
+				const std::uint32_t compressedSize = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint32_t));
+
+				return Header{
+					.version = version,
+					.pixelFormat = pixelFormat,
+					.width = width,
+					.height = height,
+					.paletteSize = paletteSize,
+					.uncompressedSize = uncompressedSize,
+					.compressedSize = compressedSize,
+				};
+			}
+
+			[[nodiscard]] std::vector<std::byte> BuildPalette(const std::vector<std::byte>& rgbaPixels, std::vector<std::byte>& out_indices)
+			{
+				std::unordered_map<std::uint32_t, std::uint8_t> paletteIndices{ };
+				std::vector<std::byte> palette{ };
+
+				out_indices.clear();
+				out_indices.reserve(rgbaPixels.size() / BytesPerPixel);
+
+				for (std::size_t i = 0u; i < rgbaPixels.size(); i += BytesPerPixel)
+				{
+					std::uint32_t colour = 0u;
+					std::memcpy(&colour, rgbaPixels.data() + i, BytesPerPixel);
+
+					auto paletteLocation = paletteIndices.find(colour);
+
+					if (paletteLocation == std::end(paletteIndices))
+					{
+						if (paletteIndices.size() >= MaxPaletteSize)
+						{
+							out_indices.clear();
+
+							return std::vector<std::byte>{ };
+						}
+
+						paletteLocation = paletteIndices.insert({ colour, static_cast<std::uint8_t>(paletteIndices.size()) }).first;
+						palette.insert(std::end(palette), rgbaPixels.data() + i, rgbaPixels.data() + i + BytesPerPixel);
+					}
+
+					out_indices.push_back(static_cast<std::byte>(paletteLocation->second));
+				}
+
+				return palette;
+			}
+
+			[[nodiscard]] bool IsCookableImage(const std::filesystem::path& filepath)
+			{
+				const std::string extension = filepath.extension().string();
+
+				return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".bmp" || extension == ".tga";
+			}
+		}
+
+		[[nodiscard]] bool IsCookedTextureData(const std::span<const std::byte> fileData)
+		{
+			return fileData.size() >= HeaderSize && std::memcmp(fileData.data(), FileMagic.data(), FileMagic.size()) == 0;
+		}
+
+		[[nodiscard]] Status Decode(const std::span<const std::byte> fileData, glm::uvec2& out_size, std::vector<std::byte>& out_pixels)
+		{
+			if (!IsCookedTextureData(fileData))
+			{
+				return Status::Fail;
+			}
+
+			const Header header = ReadHeader(fileData);
+			const std::size_t pixelCount = static_cast<std::size_t>(header.width) * static_cast<std::size_t>(header.height);
+			const std::size_t paletteByteCount = static_cast<std::size_t>(header.paletteSize) * BytesPerPixel;
+
+			const bool isIndexed = header.pixelFormat == PixelFormat::Indexed8;
+			const std::size_t expectedUncompressedSize = isIndexed ? pixelCount : pixelCount * BytesPerPixel;
+
+			if (header.version != FileVersion
+				|| (header.pixelFormat != PixelFormat::RGBA32 && !isIndexed)
+				|| pixelCount == 0u
+				|| header.uncompressedSize != expectedUncompressedSize
+				|| header.paletteSize > MaxPaletteSize
+				|| HeaderSize + paletteByteCount + header.compressedSize != fileData.size())
+			{
+				return Status::Fail;
+			}
+
+			const char* const compressedData = reinterpret_cast<const char*>(fileData.data() + HeaderSize + paletteByteCount);
+
+			if (!isIndexed)
+			{
+				out_pixels.resize(expectedUncompressedSize);
+
+				if (LZ4_decompress_safe(compressedData, reinterpret_cast<char*>(out_pixels.data()), static_cast<int>(header.compressedSize), static_cast<int>(expectedUncompressedSize)) != static_cast<int>(expectedUncompressedSize))
+				{
+					return Status::Fail;
+				}
+			}
+			else
+			{
+				std::vector<std::byte> indices(expectedUncompressedSize);
+
+				if (LZ4_decompress_safe(compressedData, reinterpret_cast<char*>(indices.data()), static_cast<int>(header.compressedSize), static_cast<int>(expectedUncompressedSize)) != static_cast<int>(expectedUncompressedSize))
+				{
+					return Status::Fail;
+				}
+
+				const std::byte* const palette = fileData.data() + HeaderSize;
+				out_pixels.resize(pixelCount * BytesPerPixel);
+
+				for (std::size_t i = 0u; i < pixelCount; ++i)
+				{
+					const std::size_t paletteIndex = static_cast<std::size_t>(indices[i]);
+
+					if (paletteIndex >= header.paletteSize)
+					{
+						return Status::Fail;
+					}
+
+					std::memcpy(out_pixels.data() + i * BytesPerPixel, palette + paletteIndex * BytesPerPixel, BytesPerPixel);
+				}
+			}
+
+			out_size = glm::uvec2{ header.width, header.height };
+
+			return Status::Success;
+		}
+
+		[[nodiscard]] Status Cook(const std::filesystem::path& sourceFilepath, const std::filesystem::path& destinationFilepath)
+		{
+			int width = 0;
+			int height = 0;
+			int channelCount = 0;
+			stbi_uc* imageData = stbi_load(sourceFilepath.string().c_str(), &width, &height, &channelCount, STBI_rgb_alpha);
+
+			if (imageData == nullptr)
+			{
+				return Status::Fail;
+			}
+
+			const std::size_t pixelByteCount = static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * BytesPerPixel;
+			const std::vector<std::byte> rgbaPixels(reinterpret_cast<const std::byte*>(imageData), reinterpret_cast<const std::byte*>(imageData) + pixelByteCount);
+
+			stbi_image_free(imageData);
+			imageData = nullptr;
+
+			std::vector<std::byte> indices{ };
+			const std::vector<std::byte> palette = BuildPalette(rgbaPixels, indices);
+
+			const bool isIndexed = !palette.empty();
+			const std::vector<std::byte>& pixelData = isIndexed ? indices : rgbaPixels;
+
+			std::vector<std::byte> compressedData(static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(pixelData.size()))));
+			const int compressedSize = LZ4_compress_HC(
+				reinterpret_cast<const char*>(pixelData.data()),
+				reinterpret_cast<char*>(compressedData.data()),
+				static_cast<int>(pixelData.size()),
+				static_cast<int>(compressedData.size()),
+				LZ4HC_CLEVEL_MAX
+			);
+
+			if (compressedSize <= 0)
+			{
+				return Status::Fail;
+			}
+
+			std::vector<std::byte> fileData(FileMagic.size());
+			std::memcpy(fileData.data(), FileMagic.data(), FileMagic.size());
+
+			binary::WriteLittleEndian(fileData, FileVersion, sizeof(std::uint16_t));
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(isIndexed ? PixelFormat::Indexed8 : PixelFormat::RGBA32), sizeof(std::uint8_t));
+			binary::WriteLittleEndian(fileData, 0u, sizeof(std::uint8_t));
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(width), sizeof(std::uint32_t));
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(height), sizeof(std::uint32_t));
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(palette.size() / BytesPerPixel), sizeof(std::uint32_t));
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(pixelData.size()), sizeof(std::uint32_t));
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(compressedSize), sizeof(std::uint32_t));
+
+			fileData.insert(std::end(fileData), std::cbegin(palette), std::cend(palette));
+			fileData.insert(std::end(fileData), std::cbegin(compressedData), std::cbegin(compressedData) + compressedSize);
+
+			return binary::WriteToFile(destinationFilepath, fileData);
+		}
+
+		[[nodiscard]] unsigned int CookDirectory(const std::filesystem::path& sourceDirectory, const std::filesystem::path& destinationDirectory)
+		{
+			std::error_code errorCode;
+			unsigned int cookedTextureCount = 0u;
+
+			for (const auto& directoryEntry : std::filesystem::recursive_directory_iterator(sourceDirectory, errorCode))
+			{
+				if (!directoryEntry.is_regular_file())
+				{
+					continue;
+				}
+
+				if (directoryEntry.path().extension() == ".taj")
+				{
+					std::filesystem::path destinationFilepath = destinationDirectory / std::filesystem::relative(directoryEntry.path(), sourceDirectory);
+					destinationFilepath.replace_extension(TextureAtlas::BinaryFileExtension);
+
+					if (TextureAtlas::Cook(directoryEntry.path(), destinationFilepath, FileExtension) == Status::Fail)
+					{
+						Log::EngineError("Failed to cook texture atlas {}.", directoryEntry.path().string());
+					}
+
+					continue;
+				}
+
+				if (!IsCookableImage(directoryEntry.path()))
+				{
+					continue;
+				}
+
+				std::filesystem::path destinationFilepath = destinationDirectory / std::filesystem::relative(directoryEntry.path(), sourceDirectory);
+				destinationFilepath.replace_extension(FileExtension);
+
+				if (Cook(directoryEntry.path(), destinationFilepath) == Status::Success)
+				{
+					Log::EngineTrace("Cooked texture {} to {}.", directoryEntry.path().string(), destinationFilepath.string());
+					++cookedTextureCount;
+				}
+				else
+				{
+					Log::EngineError("Failed to cook texture {}.", directoryEntry.path().string());
+				}
+			}
+
+			return cookedTextureCount;
+		}
+	}
+}
\ No newline at end of file
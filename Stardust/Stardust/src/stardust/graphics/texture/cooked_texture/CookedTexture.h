@@ -0,0 +1,36 @@
+#pragma once
+#ifndef COOKED_TEXTURE_H
+#define COOKED_TEXTURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../../../utility/enums/Status.h"
+
+namespace stardust
+{
+	namespace cooked_texture
+	{
+		enum class PixelFormat
+			: std::uint8_t
+		{
+			RGBA32 = 0u,
+			Indexed8 = 1u,
+		};
+
+		constexpr const char* FileExtension = ".sdtex";
+
+		[[nodiscard]] extern bool IsCookedTextureData(const std::span<const std::byte> fileData);
+		[[nodiscard]] extern Status Decode(const std::span<const std::byte> fileData, glm::uvec2& out_size, std::vector<std::byte>& out_pixels);
+
+		[[nodiscard]] extern Status Cook(const std::filesystem::path& sourceFilepath, const std::filesystem::path& destinationFilepath);
+		[[nodiscard]] extern unsigned int CookDirectory(const std::filesystem::path& sourceDirectory, const std::filesystem::path& destinationDirectory);
+	}
+}
+
+#endif
\ No newline at end of file
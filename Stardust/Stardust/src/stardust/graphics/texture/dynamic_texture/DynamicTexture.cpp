@@ -0,0 +1,244 @@
+#include "DynamicTexture.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace stardust
+{
+	DynamicTexture::DynamicTexture(const Renderer& renderer, const glm::uvec2& size, const std::uint32_t format, const std::size_t ringSize)
+	{
+		Initialise(renderer, size, format, ringSize);
+	}
+
+	DynamicTexture::DynamicTexture(DynamicTexture&& other) noexcept
+		: m_textures(), m_staleAreas({ }), m_currentTextureIndex(0u), m_size(glm::uvec2{ 0u, 0u }), m_format(0u), m_bytesPerPixel(0u), m_pixels({ }), m_hasPendingChanges(false),
+		  m_uploadStatistics(UploadStatistics{ }), m_statisticsStartTicks(0u)
+	{
+		std::swap(m_textures, other.m_textures);
+		std::swap(m_staleAreas, other.m_staleAreas);
+		std::swap(m_currentTextureIndex, other.m_currentTextureIndex);
+
+		std::swap(m_size, other.m_size);
+		std::swap(m_format, other.m_format);
+		std::swap(m_bytesPerPixel, other.m_bytesPerPixel);
+
+		std::swap(m_pixels, other.m_pixels);
+		std::swap(m_hasPendingChanges, other.m_hasPendingChanges);
+
+		std::swap(m_uploadStatistics, other.m_uploadStatistics);
+		std::swap(m_statisticsStartTicks, other.m_statisticsStartTicks);
+	}
+
+	DynamicTexture& DynamicTexture::operator =(DynamicTexture&& other) noexcept
+	{
+		m_textures = std::exchange(other.m_textures, { });
+		m_staleAreas = std::exchange(other.m_staleAreas, { });
+		m_currentTextureIndex = std::exchange(other.m_currentTextureIndex, 0u);
+
+		m_size = std::exchange(other.m_size, glm::uvec2{ 0u, 0u });
+		m_format = std::exchange(other.m_format, 0u);
+		m_bytesPerPixel = std::exchange(other.m_bytesPerPixel, 0u);
+
+		m_pixels = std::exchange(other.m_pixels, { });
+		m_hasPendingChanges = std::exchange(other.m_hasPendingChanges, false);
+
+		m_uploadStatistics = std::exchange(other.m_uploadStatistics, UploadStatistics{ });
+		m_statisticsStartTicks = std::exchange(other.m_statisticsStartTicks, 0u);
+
+		return *this;
+	}
+
+	DynamicTexture::~DynamicTexture() noexcept
+	{
+		Destroy();
+	}
+
+	void DynamicTexture::Initialise(const Renderer& renderer, const glm::uvec2& size, const std::uint32_t format, const std::size_t ringSize)
+	{
+		Destroy();
+
+		m_size = size;
+		m_format = format;
+		m_bytesPerPixel = SDL_BYTESPERPIXEL(format);
+
+		const std::size_t textureCount = std::max(ringSize, static_cast<std::size_t>(1u));
+		m_textures.reserve(textureCount);
+
+		for (std::size_t i = 0u; i < textureCount; ++i)
+		{
+			Texture streamingTexture(renderer, format, Texture::AccessType::Streaming, size);
+
+			if (!streamingTexture.IsValid())
+			{
+				Destroy();
+
+				return;
+			}
+
+			m_textures.push_back(std::move(streamingTexture));
+		}
+
+		m_staleAreas = std::vector<std::optional<rect::Rect>>(textureCount, std::nullopt);
+		m_currentTextureIndex = 0u;
+
+		m_pixels = std::vector<std::byte>(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * m_bytesPerPixel, std::byte{ 0 });
+		MarkDirty();
+
+		ResetUploadStatistics();
+	}
+
+	void DynamicTexture::Destroy() noexcept
+	{
+		m_textures.clear();
+		m_staleAreas.clear();
+		m_currentTextureIndex = 0u;
+
+		m_size = glm::uvec2{ 0u, 0u };
+		m_format = 0u;
+		m_bytesPerPixel = 0u;
+
+		m_pixels.clear();
+		m_hasPendingChanges = false;
+	}
+
+	void DynamicTexture::UpdateArea(const std::optional<rect::Rect>& areaToUpdate, const void* const pixels, const unsigned int pixelRowLength)
+	{
+		const std::optional<rect::Rect> clippedArea = areaToUpdate.has_value()
+			? rect::GetIntersection(areaToUpdate.value(), rect::Create(0, 0, m_size.x, m_size.y))
+			: rect::Create(0, 0, m_size.x, m_size.y);
+
+		if (!IsValid() || !clippedArea.has_value())
+		{
+			return;
+		}
+
+		const rect::Rect& area = clippedArea.value();
+		const std::size_t sourceOffsetX = areaToUpdate.has_value() ? static_cast<std::size_t>(area.x - areaToUpdate->x) : 0u;
+		const std::size_t sourceOffsetY = areaToUpdate.has_value() ? static_cast<std::size_t>(area.y - areaToUpdate->y) : 0u;
+		const std::size_t rowByteCount = static_cast<std::size_t>(area.w) * m_bytesPerPixel;
+
+		const std::byte* const sourcePixels = static_cast<const std::byte*>(pixels);
+
+		for (int row = 0; row < area.h; ++row)
+		{
+			std::memcpy(
+				m_pixels.data() + static_cast<std::size_t>(area.y + row) * GetPitch() + static_cast<std::size_t>(area.x) * m_bytesPerPixel,
+				sourcePixels + (sourceOffsetY + static_cast<std::size_t>(row)) * pixelRowLength + sourceOffsetX * m_bytesPerPixel,
+				rowByteCount
+			);
+		}
+
+		MarkDirty(area);
+	}
+
+	void DynamicTexture::MarkDirty(const std::optional<rect::Rect>& dirtyArea)
+	{
+		const rect::Rect fullArea = rect::Create(0, 0, m_size.x, m_size.y);
+		const std::optional<rect::Rect> clippedArea = dirtyArea.has_value() ? rect::GetIntersection(dirtyArea.value(), fullArea) : fullArea;
+
+		if (!clippedArea.has_value())
+		{
+			return;
+		}
+
+		for (auto& staleArea : m_staleAreas)
+		{
+			staleArea = staleArea.has_value() ? rect::GetUnion(staleArea.value(), clippedArea.value()) : clippedArea.value();
+		}
+
+		m_hasPendingChanges = true;
+	}
+
+	const Texture& DynamicTexture::Upload()
+	{
+		m_uploadStatistics.lastUploadByteCount = 0u;
+
+		if (!m_hasPendingChanges)
+		{
+			++m_uploadStatistics.skippedUploadCount;
+
+			return GetTexture();
+		}
+
+		const std::size_t nextTextureIndex = (m_currentTextureIndex + 1u) % m_textures.size();
+		std::optional<rect::Rect>& staleArea = m_staleAreas[nextTextureIndex];
+
+		if (staleArea.has_value())
+		{
+			if (!UploadStaleArea(m_textures[nextTextureIndex], staleArea.value()))
+			{
+				return GetTexture();
+			}
+
+			m_uploadStatistics.lastUploadByteCount = static_cast<std::uint64_t>(staleArea->w) * static_cast<std::uint64_t>(staleArea->h) * m_bytesPerPixel;
+			m_uploadStatistics.totalUploadByteCount += m_uploadStatistics.lastUploadByteCount;
+			++m_uploadStatistics.uploadCount;
+
+			staleArea = std::nullopt;
+		}
+
+		m_currentTextureIndex = nextTextureIndex;
+		m_hasPendingChanges = false;
+
+		return GetTexture();
+	}
+
+	void DynamicTexture::SetBlendMode(const Renderer::BlendMode blendMode) const noexcept
+	{
+		for (const auto& texture : m_textures)
+		{
+			texture.SetBlendMode(blendMode);
+		}
+	}
+
+	void DynamicTexture::SetScaleMode(const Texture::ScaleMode scaleMode) const noexcept
+	{
+		for (const auto& texture : m_textures)
+		{
+			texture.SetScaleMode(scaleMode);
+		}
+	}
+
+	void DynamicTexture::ResetUploadStatistics() noexcept
+	{
+		m_uploadStatistics = UploadStatistics{ };
+		m_statisticsStartTicks = SDL_GetPerformanceCounter();
+	}
+
+	[[nodiscard]] double DynamicTexture::GetUploadBandwidth() const noexcept
+	{
+		const double elapsedSeconds = static_cast<double>(SDL_GetPerformanceCounter() - m_statisticsStartTicks) / static_cast<double>(SDL_GetPerformanceFrequency());
+
+		return elapsedSeconds > 0.0 ? static_cast<double>(m_uploadStatistics.totalUploadByteCount) / elapsedSeconds : 0.0;
+	}
+
+	[[nodiscard]] bool DynamicTexture::UploadStaleArea(Texture& texture, const rect::Rect& staleArea) const
+	{
+		void* lockedPixels = nullptr;
+		unsigned int lockedPitch = 0u;
+
+		texture.Lock(staleArea, lockedPixels, lockedPitch);
+
+		if (!texture.IsLocked())
+		{
+			return false;
+		}
+
+		const std::size_t rowByteCount = static_cast<std::size_t>(staleArea.w) * m_bytesPerPixel;
+		std::byte* const destinationPixels = static_cast<std::byte*>(lockedPixels);
+
+		for (int row = 0; row < staleArea.h; ++row)
+		{
+			std::memcpy(
+				destinationPixels + static_cast<std::size_t>(row) * lockedPitch,
+				m_pixels.data() + static_cast<std::size_t>(staleArea.y + row) * GetPitch() + static_cast<std::size_t>(staleArea.x) * m_bytesPerPixel,
+				rowByteCount
+			);
+		}
+
+		texture.Unlock();
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+#ifndef DYNAMIC_TEXTURE_H
+#define DYNAMIC_TEXTURE_H
+
+#include "../../../utility/interfaces/INoncopyable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <SDL2/SDL.h>
+
+#include "../../../rect/Rect.h"
+#include "../../renderer/Renderer.h"
+#include "../Texture.h"
+
+namespace stardust
+{
+	class DynamicTexture
+		: private INoncopyable
+	{
+	public:
+		struct UploadStatistics
+		{
+			unsigned int uploadCount = 0u;
+			unsigned int skippedUploadCount = 0u;
+
+			std::uint64_t lastUploadByteCount = 0u;
+			std::uint64_t totalUploadByteCount = 0u;
+		};
+
+	private:
+		static constexpr std::size_t s_DefaultRingSize = 3u;
+
+		std::vector<Texture> m_textures{ };
+		std::vector<std::optional<rect::Rect>> m_staleAreas{ };
+		std::size_t m_currentTextureIndex = 0u;
+
+		glm::uvec2 m_size{ 0u, 0u };
+		std::uint32_t m_format = 0u;
+		unsigned int m_bytesPerPixel = 0u;
+
+		std::vector<std::byte> m_pixels{ };
+		bool m_hasPendingChanges = false;
+
+		UploadStatistics m_uploadStatistics{ };
+		std::uint64_t m_statisticsStartTicks = 0u;
+
+	public:
+		DynamicTexture() = default;
+		DynamicTexture(const Renderer& renderer, const glm::uvec2& size, const std::uint32_t format = SDL_PIXELFORMAT_RGBA32, const std::size_t ringSize = s_DefaultRingSize);
+
+		DynamicTexture(DynamicTexture&& other) noexcept;
+		DynamicTexture& operator =(DynamicTexture&& other) noexcept;
+
+		~DynamicTexture() noexcept;
+
+		void Initialise(const Renderer& renderer, const glm::uvec2& size, const std::uint32_t format = SDL_PIXELFORMAT_RGBA32, const std::size_t ringSize = s_DefaultRingSize);
+		void Destroy() noexcept;
+
+		void UpdateArea(const std::optional<rect::Rect>& areaToUpdate, const void* const pixels, const unsigned int pixelRowLength);
+		void MarkDirty(const std::optional<rect::Rect>& dirtyArea = std::nullopt);
+
+		const Texture& Upload();
+
+		inline bool IsValid() const noexcept { return !m_textures.empty(); }
+		inline bool HasPendingChanges() const noexcept { return m_hasPendingChanges; }
+
+		inline std::byte* GetPixels() noexcept { return m_pixels.data(); }
+		inline const std::byte* GetPixels() const noexcept { return m_pixels.data(); }
+		inline unsigned int GetPitch() const noexcept { return m_size.x * m_bytesPerPixel; }
+
+		inline const Texture& GetTexture() const noexcept { return m_textures[m_currentTextureIndex]; }
+		inline std::size_t GetRingSize() const noexcept { return m_textures.size(); }
+
+		inline const glm::uvec2& GetSize() const noexcept { return m_size; }
+		inline std::uint32_t GetFormat() const noexcept { return m_format; }
+
+		void SetBlendMode(const Renderer::BlendMode blendMode) const noexcept;
+		void SetScaleMode(const Texture::ScaleMode scaleMode) const noexcept;
+
+		inline const UploadStatistics& GetUploadStatistics() const noexcept { return m_uploadStatistics; }
+		void ResetUploadStatistics() noexcept;
+		[[nodiscard]] double GetUploadBandwidth() const noexcept;
+
+	private:
+		[[nodiscard]] bool UploadStaleArea(Texture& texture, const rect::Rect& staleArea) const;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -1,10 +1,16 @@
 #include "TextureAtlas.h"
 
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <unordered_set>
 #include <utility>
-#include <vector>
 
 #include <nlohmann/json.hpp>
 
+#include "../../../debug/logging/Log.h"
+#include "../../../utility/binary/Binary.h"
 #include "../../../vfs/VFS.h"
 
 namespace stardust
@@ -15,16 +21,22 @@ namespace stardust
 	}
 
 	TextureAtlas::TextureAtlas(TextureAtlas&& other) noexcept
-		: m_texture(std::move(other.m_texture)), m_subtextures(other.m_subtextures)
+		: m_texture(std::move(other.m_texture)), m_textureFilename(std::move(other.m_textureFilename)), m_subtextures(std::move(other.m_subtextures)), m_subtextureNames(std::move(other.m_subtextureNames)), m_subtextureIndices(std::move(other.m_subtextureIndices))
 	{
 		other.m_texture = Texture();
+		other.m_textureFilename.clear();
 		other.m_subtextures = { };
+		other.m_subtextureNames = { };
+		other.m_subtextureIndices = { };
 	}
 
 	TextureAtlas& TextureAtlas::operator =(TextureAtlas&& other) noexcept
 	{
 		m_texture = std::exchange(other.m_texture, Texture());
+		m_textureFilename = std::exchange(other.m_textureFilename, { });
 		m_subtextures = std::exchange(other.m_subtextures, { });
+		m_subtextureNames = std::exchange(other.m_subtextureNames, { });
+		m_subtextureIndices = std::exchange(other.m_subtextureIndices, { });
 
 		return *this;
 	}
@@ -43,6 +55,260 @@ namespace stardust
 			return;
 		}
 
+		const bool isBinaryData = textureAtlasData.size() >= sizeof(s_FileMagic) && std::memcmp(textureAtlasData.data(), s_FileMagic, sizeof(s_FileMagic)) == 0;
+		const bool didLoad = isBinaryData ? LoadFromBinaryData(textureAtlasData) : LoadFromJSONData(textureAtlasData);
+
+		if (!didLoad)
+		{
+			Log::EngineError("Failed to parse texture atlas {}.", filepath);
+			m_textureFilename.clear();
+			m_subtextures.clear();
+			m_subtextureNames.clear();
+			m_subtextureIndices.clear();
+
+			return;
+		}
+
+		const std::string textureFilename = vfs::GetParentFilepath(filepath) + "/" + m_textureFilename;
+		m_texture = Texture(renderer, textureFilename);
+	}
+
+	void TextureAtlas::Destroy() noexcept
+	{
+		if (m_texture.IsValid())
+		{
+			m_texture.Destroy();
+			m_textureFilename.clear();
+			m_subtextures.clear();
+			m_subtextureNames.clear();
+			m_subtextureIndices.clear();
+		}
+	}
+
+	[[nodiscard]] Status TextureAtlas::WriteBinaryFile(const std::string_view& filepath) const
+	{
+		std::vector<std::byte> fileData{ };
+
+		if (SerialiseBinary(m_textureFilename, m_subtextureNames, m_subtextures, fileData) == Status::Fail)
+		{
+			return Status::Fail;
+		}
+
+		return vfs::WriteToFile(filepath, fileData);
+	}
+
+	[[nodiscard]] Status TextureAtlas::Cook(const std::filesystem::path& sourceFilepath, const std::filesystem::path& destinationFilepath, const std::string_view& textureFileExtension)
+	{
+		std::ifstream sourceFile(sourceFilepath, std::ios_base::binary);
+
+		if (!sourceFile.is_open())
+		{
+			return Status::Fail;
+		}
+
+		const std::string sourceData{ std::istreambuf_iterator<char>(sourceFile), std::istreambuf_iterator<char>() };
+		std::vector<std::byte> textureAtlasData(sourceData.size());
+		std::memcpy(textureAtlasData.data(), sourceData.data(), sourceData.size());
+
+		TextureAtlas textureAtlas;
+
+		if (!textureAtlas.LoadFromJSONData(textureAtlasData))
+		{
+			return Status::Fail;
+		}
+
+		std::string textureFilename = textureAtlas.m_textureFilename;
+
+		if (!textureFileExtension.empty())
+		{
+			textureFilename = std::filesystem::path(textureFilename).replace_extension(textureFileExtension).generic_string();
+		}
+
+		std::vector<std::byte> fileData{ };
+
+		if (SerialiseBinary(textureFilename, textureAtlas.m_subtextureNames, textureAtlas.m_subtextures, fileData) == Status::Fail)
+		{
+			return Status::Fail;
+		}
+
+		return binary::WriteToFile(destinationFilepath, fileData);
+	}
+
+	[[nodiscard]] Status TextureAtlas::SerialiseBinary(const std::string& textureFilename, const std::vector<std::string>& subtextureNames, const std::vector<rect::Rect>& subtextureRects, std::vector<std::byte>& out_fileData)
+	{
+		constexpr auto IsValidCoordinate = [](const long long coordinate) noexcept -> bool
+		{
+			return coordinate >= 0 && coordinate <= static_cast<long long>(std::numeric_limits<std::uint16_t>::max());
+		};
+
+		if (subtextureNames.size() != subtextureRects.size() || subtextureNames.size() > std::numeric_limits<std::uint32_t>::max())
+		{
+			Log::EngineError("Texture atlas has {} subtexture names but {} subtexture areas.", subtextureNames.size(), subtextureRects.size());
+
+			return Status::Fail;
+		}
+
+		if (textureFilename.length() > std::numeric_limits<std::uint16_t>::max())
+		{
+			Log::EngineError("Texture atlas texture filename {} is longer than {} bytes.", textureFilename, std::numeric_limits<std::uint16_t>::max());
+
+			return Status::Fail;
+		}
+
+		std::unordered_set<std::string_view> serialisedNames{ };
+		serialisedNames.reserve(subtextureNames.size());
+
+		for (std::size_t i = 0u; i < subtextureNames.size(); ++i)
+		{
+			const std::string& name = subtextureNames[i];
+			const rect::Rect& area = subtextureRects[i];
+
+			if (name.length() > std::numeric_limits<std::uint8_t>::max())
+			{
+				Log::EngineError("Texture atlas subtexture name {} is longer than {} bytes.", name, std::numeric_limits<std::uint8_t>::max());
+
+				return Status::Fail;
+			}
+
+			if (!serialisedNames.insert(name).second)
+			{
+				Log::EngineError("Texture atlas subtexture name {} is duplicated.", name);
+
+				return Status::Fail;
+			}
+
+			if (!IsValidCoordinate(area.x) || !IsValidCoordinate(area.y) || !IsValidCoordinate(area.w) || !IsValidCoordinate(area.h))
+			{
+				Log::EngineError("Texture atlas subtexture {} area ({}, {}, {}, {}) does not fit in 16-bit coordinates.", name, area.x, area.y, area.w, area.h);
+
+				return Status::Fail;
+			}
+		}
+
+		std::vector<std::byte> fileData(sizeof(s_FileMagic));
+		std::memcpy(fileData.data(), s_FileMagic, sizeof(s_FileMagic));
+
+		binary::WriteLittleEndian(fileData, s_FileVersion, sizeof(std::uint16_t));
+		binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(subtextureNames.size()), sizeof(std::uint32_t));
+		binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(textureFilename.length()), sizeof(std::uint16_t));
+
+		for (const char character : textureFilename)
+		{
+			fileData.push_back(static_cast<std::byte>(character));
+		}
+
+		for (std::size_t i = 0u; i < subtextureNames.size(); ++i)
+		{
+			const std::string& name = subtextureNames[i];
+			const rect::Rect& area = subtextureRects[i];
+
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(name.length()), sizeof(std::uint8_t));
+
+			for (const char character : name)
+			{
+				fileData.push_back(static_cast<std::byte>(character));
+			}
+
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(area.x), sizeof(std::uint16_t));
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(area.y), sizeof(std::uint16_t));
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(area.w), sizeof(std::uint16_t));
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(area.h), sizeof(std::uint16_t));
+		}
+
+		out_fileData = std::move(fileData);
+
+		return Status::Success;
+	}
+
+	[[nodiscard]] std::optional<TextureAtlas::SubtextureIndex> TextureAtlas::GetSubtextureIndex(const StringID name) const
+	{
+		if (const auto subtextureIndex = m_subtextureIndices.find(name);
+			subtextureIndex != std::cend(m_subtextureIndices))
+		{
+			return subtextureIndex->second;
+		}
+
+		return std::nullopt;
+	}
+
+	[[nodiscard]] bool TextureAtlas::LoadFromBinaryData(const std::vector<std::byte>& textureAtlasData)
+	{
+		constexpr std::size_t HeaderSize = sizeof(s_FileMagic) + sizeof(std::uint16_t) + sizeof(std::uint32_t) + sizeof(std::uint16_t);
+		constexpr std::size_t SubtextureAreaSize = sizeof(std::uint16_t) * 4u;
+
+		if (textureAtlasData.size() < HeaderSize)
+		{
+			return false;
+		}
+
+		std::size_t offset = sizeof(s_FileMagic);
+
+		if (binary::ReadLittleEndian(textureAtlasData, offset, sizeof(std::uint16_t)) != s_FileVersion)
+		{
+			return false;
+		}
+
+		const std::uint32_t subtextureCount = binary::ReadLittleEndian(textureAtlasData, offset, sizeof(std::uint32_t));
+		const std::size_t textureFilenameLength = binary::ReadLittleEndian(textureAtlasData, offset, sizeof(std::uint16_t));
+
+		if (offset + textureFilenameLength > textureAtlasData.size())
+		{
+			return false;
+		}
+
+		m_textureFilename.assign(reinterpret_cast<const char*>(textureAtlasData.data() + offset), textureFilenameLength);
+		offset += textureFilenameLength;
+
+		if (subtextureCount > (textureAtlasData.size() - offset) / (sizeof(std::uint8_t) + SubtextureAreaSize))
+		{
+			return false;
+		}
+
+		m_subtextures.clear();
+		m_subtextures.reserve(subtextureCount);
+		m_subtextureNames.clear();
+		m_subtextureNames.reserve(subtextureCount);
+		m_subtextureIndices.clear();
+		m_subtextureIndices.reserve(subtextureCount);
+
+		for (std::uint32_t i = 0u; i < subtextureCount; ++i)
+		{
+			if (offset + sizeof(std::uint8_t) > textureAtlasData.size())
+			{
+				return false;
+			}
+
+			const std::size_t nameLength = binary::ReadLittleEndian(textureAtlasData, offset, sizeof(std::uint8_t));
+
+			if (offset + nameLength + SubtextureAreaSize > textureAtlasData.size())
+			{
+				return false;
+			}
+
+			std::string name(reinterpret_cast<const char*>(textureAtlasData.data() + offset), nameLength);
+			offset += nameLength;
+
+			const int x = static_cast<int>(binary::ReadLittleEndian(textureAtlasData, offset, sizeof(std::uint16_t)));
+			const int y = static_cast<int>(binary::ReadLittleEndian(textureAtlasData, offset, sizeof(std::uint16_t)));
+			const unsigned int width = binary::ReadLittleEndian(textureAtlasData, offset, sizeof(std::uint16_t));
+			const unsigned int height = binary::ReadLittleEndian(textureAtlasData, offset, sizeof(std::uint16_t));
+
+			if (!m_subtextureIndices.try_emplace(StringID::Intern(name), static_cast<SubtextureIndex>(m_subtextures.size())).second)
+			{
+				Log::EngineError("Texture atlas subtexture name {} is duplicated.", name);
+
+				return false;
+			}
+
+			m_subtextureNames.push_back(std::move(name));
+			m_subtextures.push_back(rect::Create(x, y, width, height));
+		}
+
+		return true;
+	}
+
+	[[nodiscard]] bool TextureAtlas::LoadFromJSONData(const std::vector<std::byte>& textureAtlasData)
+	{
 		const nlohmann::json textureAtlasJSON = nlohmann::json::parse(
 			reinterpret_cast<const unsigned char*>(textureAtlasData.data()),
 			reinterpret_cast<const unsigned char*>(textureAtlasData.data()) + textureAtlasData.size(),
@@ -52,11 +318,14 @@ namespace stardust
 
 		if (textureAtlasJSON.is_discarded())
 		{
-			return;
+			return false;
 		}
-		
-		const std::string textureFilename = vfs::GetParentFilepath(filepath) + "/" + std::string(textureAtlasJSON["texture_file"]);
-		m_texture = Texture(renderer, textureFilename);
+
+		m_textureFilename = std::string(textureAtlasJSON["texture_file"]);
+
+		m_subtextures.clear();
+		m_subtextureNames.clear();
+		m_subtextureIndices.clear();
 
 		for (const auto& subtexture : textureAtlasJSON["subtextures"])
 		{
@@ -67,16 +336,19 @@ namespace stardust
 				subtexture["rect"]["height"]
 			);
 
-			m_subtextures[subtexture["name"]] = subtextureRect;
-		}
-	}
+			const std::string subtextureName = subtexture["name"];
 
-	void TextureAtlas::Destroy() noexcept
-	{
-		if (m_texture.IsValid())
-		{
-			m_texture.Destroy();
-			m_subtextures.clear();
+			if (!m_subtextureIndices.try_emplace(StringID::Intern(subtextureName), static_cast<SubtextureIndex>(m_subtextures.size())).second)
+			{
+				Log::EngineError("Texture atlas subtexture name {} is duplicated.", subtextureName);
+
+				return false;
+			}
+
+			m_subtextureNames.push_back(subtextureName);
+			m_subtextures.push_back(subtextureRect);
 		}
+
+		return true;
 	}
 }
\ No newline at end of file
@@ -5,11 +5,17 @@
 #include "../../../utility/interfaces/INoncopyable.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include "../../../rect/Rect.h"
+#include "../../../utility/enums/Status.h"
+#include "../../../utility/string_id/StringID.h"
 #include "../../renderer/Renderer.h"
 #include "../Texture.h"
 
@@ -18,10 +24,21 @@ namespace stardust
 	class TextureAtlas
 		: private INoncopyable
 	{
+	public:
+		using SubtextureIndex = std::uint32_t;
+
+		static constexpr const char* BinaryFileExtension = ".tab";
+
 	private:
+		static constexpr char s_FileMagic[4u]{ 'S', 'D', 'T', 'A' };
+		static constexpr std::uint16_t s_FileVersion = 1u;
+
 		Texture m_texture;
+		std::string m_textureFilename;
 
-		std::unordered_map<std::string, rect::Rect> m_subtextures{ };
+		std::vector<rect::Rect> m_subtextures{ };
+		std::vector<std::string> m_subtextureNames{ };
+		std::unordered_map<StringID, SubtextureIndex> m_subtextureIndices{ };
 
 	public:
 		TextureAtlas() = default;
@@ -35,16 +52,30 @@ namespace stardust
 		void Initialise(const Renderer& renderer, const std::string_view& filepath);
 		void Destroy() noexcept;
 
+		[[nodiscard]] Status WriteBinaryFile(const std::string_view& filepath) const;
+		[[nodiscard]] static Status Cook(const std::filesystem::path& sourceFilepath, const std::filesystem::path& destinationFilepath, const std::string_view& textureFileExtension = "");
+		[[nodiscard]] static Status SerialiseBinary(const std::string& textureFilename, const std::vector<std::string>& subtextureNames, const std::vector<rect::Rect>& subtextureRects, std::vector<std::byte>& out_fileData);
+
 		inline bool IsTextureValid() const noexcept { return m_texture.IsValid(); }
 
-		inline const rect::Rect& GetSubtexture(const std::string& name) const { return m_subtextures.at(name); }
-		inline const rect::Rect& operator [](const std::string& name) const { return GetSubtexture(name); }
+		[[nodiscard]] std::optional<SubtextureIndex> GetSubtextureIndex(const StringID name) const;
+		inline const rect::Rect& GetSubtexture(const SubtextureIndex index) const noexcept { return m_subtextures[index]; }
+		inline const rect::Rect& operator [](const SubtextureIndex index) const noexcept { return GetSubtexture(index); }
+
+		inline const rect::Rect& GetSubtexture(const StringID name) const { return m_subtextures[m_subtextureIndices.at(name)]; }
+		inline const rect::Rect& operator [](const StringID name) const { return GetSubtexture(name); }
 
 		inline Texture& GetTexture() noexcept { return m_texture; }
 		inline const Texture& GetTexture() const noexcept { return m_texture; }
-		inline const decltype(m_subtextures)& GetSubtextures() const noexcept { return m_subtextures; }
+		inline const std::vector<rect::Rect>& GetSubtextures() const noexcept { return m_subtextures; }
+		inline const std::vector<std::string>& GetSubtextureNames() const noexcept { return m_subtextureNames; }
+		inline const decltype(m_subtextureIndices)& GetSubtextureIndices() const noexcept { return m_subtextureIndices; }
 
 		inline const std::size_t GetSubtextureCount() const noexcept { return m_subtextures.size(); }
+
+	private:
+		[[nodiscard]] bool LoadFromBinaryData(const std::vector<std::byte>& textureAtlasData);
+		[[nodiscard]] bool LoadFromJSONData(const std::vector<std::byte>& textureAtlasData);
 	};
 }
 
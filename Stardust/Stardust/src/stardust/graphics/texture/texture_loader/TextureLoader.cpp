@@ -0,0 +1,229 @@
+#include "TextureLoader.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <stb/stb_image.h>
+
+#include "../../../debug/logging/Log.h"
+#include "../../../vfs/VFS.h"
+#include "../cooked_texture/CookedTexture.h"
+
+namespace stardust
+{
+	[[nodiscard]] unsigned int TextureLoader::GetDefaultWorkerCount() noexcept
+	{
+		const unsigned int hardwareThreadCount = std::thread::hardware_concurrency();
+
+		return hardwareThreadCount > 1u ? hardwareThreadCount - 1u : 1u;
+	}
+
+	TextureLoader::TextureLoader(const Renderer& renderer, vfs::AsyncReader& asyncReader, const unsigned int workerCount)
+	{
+		Initialise(renderer, asyncReader, workerCount);
+	}
+
+	TextureLoader::~TextureLoader() noexcept
+	{
+		Destroy();
+	}
+
+	void TextureLoader::Initialise(const Renderer& renderer, vfs::AsyncReader& asyncReader, const unsigned int workerCount)
+	{
+		Destroy();
+
+		m_renderer = &renderer;
+		m_asyncReader = &asyncReader;
+		m_decodeQueue.Initialise(workerCount);
+	}
+
+	void TextureLoader::Destroy() noexcept
+	{
+		if (m_decodeQueue.IsValid())
+		{
+			m_decodeQueue.Destroy();
+
+			for (const auto& [readID, requestID] : std::exchange(m_pendingReads, { }))
+			{
+				m_asyncReader->Cancel(requestID);
+			}
+
+			m_renderer = nullptr;
+			m_asyncReader = nullptr;
+		}
+	}
+
+	void TextureLoader::LoadAsync(const std::string_view& filepath, const LoadCallback& callback)
+	{
+		DecodeAsync(filepath, [this, textureFilepath = std::string(filepath), callback](PixelSurface&& surface)
+		{
+			Texture texture;
+
+			if (surface.IsValid())
+			{
+				texture.Initialise(*m_renderer, surface.GetRawHandle());
+			}
+
+			if (!texture.IsValid())
+			{
+				Log::EngineWarn("Failed to load texture {} asynchronously.", textureFilepath);
+			}
+
+			callback(std::move(texture));
+		});
+	}
+
+	[[nodiscard]] std::future<Texture> TextureLoader::LoadAsync(const std::string_view& filepath)
+	{
+		const std::shared_ptr<std::promise<Texture>> texturePromise = std::make_shared<std::promise<Texture>>();
+		std::future<Texture> textureFuture = texturePromise->get_future();
+
+		LoadAsync(filepath, [texturePromise](Texture&& texture)
+		{
+			texturePromise->set_value(std::move(texture));
+		});
+
+		return textureFuture;
+	}
+
+	void TextureLoader::DecodeAsync(const std::string_view& filepath, const DecodeCallback& callback)
+	{
+		if (!m_decodeQueue.IsValid())
+		{
+			callback(PixelSurface());
+
+			return;
+		}
+
+		if (!m_asyncReader->IsValid())
+		{
+			m_decodeQueue.Submit([imageFilepath = std::string(filepath)]()
+			{
+				return DecodeImage(imageFilepath);
+			}, callback);
+
+			return;
+		}
+
+		const std::uint64_t readID = m_nextReadID++;
+
+		m_pendingReads[readID] = m_asyncReader->Read(filepath, [this, readID, callback](vfs::FileView&& fileView)
+		{
+			m_pendingReads.erase(readID);
+
+			if (!m_decodeQueue.IsValid())
+			{
+				return;
+			}
+
+			const std::shared_ptr<vfs::FileView> rawImageData = std::make_shared<vfs::FileView>(std::move(fileView));
+
+			m_decodeQueue.Submit([rawImageData]()
+			{
+				return DecodeImage(*rawImageData);
+			}, callback);
+		});
+	}
+
+	void TextureLoader::ProcessUploads()
+	{
+		const std::uint64_t startTicks = SDL_GetPerformanceCounter();
+		const std::uint64_t budgetTicks = static_cast<std::uint64_t>(m_uploadTimeBudget * static_cast<float>(SDL_GetPerformanceFrequency()));
+
+		while (m_decodeQueue.ProcessNextCompletion())
+		{
+			if (SDL_GetPerformanceCounter() - startTicks >= budgetTicks)
+			{
+				break;
+			}
+		}
+	}
+
+	void TextureLoader::WaitForAll()
+	{
+		while (m_decodeQueue.IsValid() && !IsIdle())
+		{
+			if (!m_pendingReads.empty())
+			{
+				if (!m_asyncReader->IsValid())
+				{
+					break;
+				}
+
+				m_asyncReader->WaitForAll();
+			}
+
+			m_decodeQueue.WaitForAll();
+		}
+	}
+
+	[[nodiscard]] PixelSurface TextureLoader::DecodeImage(const std::string_view& filepath)
+	{
+		return DecodeImage(vfs::ReadFileView(filepath));
+	}
+
+	[[nodiscard]] PixelSurface TextureLoader::DecodeImage(const vfs::FileView& rawImageData)
+	{
+		if (rawImageData.IsEmpty())
+		{
+			return PixelSurface();
+		}
+
+		if (cooked_texture::IsCookedTextureData(rawImageData.GetBytes()))
+		{
+			glm::uvec2 size{ 0u, 0u };
+			std::vector<std::byte> pixels{ };
+
+			if (cooked_texture::Decode(rawImageData.GetBytes(), size, pixels) == Status::Fail)
+			{
+				return PixelSurface();
+			}
+
+			PixelSurface cookedSurface(size.x, size.y, 4u);
+
+			if (cookedSurface.IsValid())
+			{
+				const std::size_t rowByteCount = static_cast<std::size_t>(size.x) * 4u;
+				std::byte* const surfacePixels = static_cast<std::byte*>(cookedSurface.GetPixels());
+
+				for (unsigned int row = 0u; row < size.y; ++row)
+				{
+					std::memcpy(surfacePixels + static_cast<std::size_t>(row) * cookedSurface.GetPitch(), pixels.data() + static_cast<std::size_t>(row) * rowByteCount, rowByteCount);
+				}
+			}
+
+			return cookedSurface;
+		}
+
+		int width = 0;
+		int height = 0;
+		int channelCount = 0;
+		stbi_uc* imageData = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(rawImageData.GetData()), static_cast<int>(rawImageData.GetSize()), &width, &height, &channelCount, STBI_default);
+
+		if (imageData == nullptr)
+		{
+			return PixelSurface();
+		}
+
+		PixelSurface decodedSurface(static_cast<unsigned int>(width), static_cast<unsigned int>(height), static_cast<unsigned int>(channelCount));
+
+		if (decodedSurface.IsValid())
+		{
+			const std::size_t rowByteCount = static_cast<std::size_t>(width) * static_cast<std::size_t>(channelCount);
+			std::byte* const surfacePixels = static_cast<std::byte*>(decodedSurface.GetPixels());
+
+			for (int row = 0; row < height; ++row)
+			{
+				std::memcpy(surfacePixels + static_cast<std::size_t>(row) * decodedSurface.GetPitch(), imageData + static_cast<std::size_t>(row) * rowByteCount, rowByteCount);
+			}
+		}
+
+		stbi_image_free(imageData);
+		imageData = nullptr;
+
+		return decodedSurface;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+#ifndef TEXTURE_LOADER_H
+#define TEXTURE_LOADER_H
+
+#include "../../../utility/interfaces/INoncopyable.h"
+#include "../../../utility/interfaces/INonmovable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <string_view>
+#include <unordered_map>
+
+#include "../../../utility/threading/WorkerQueue.h"
+#include "../../../vfs/AsyncReader.h"
+#include "../../../vfs/FileView.h"
+#include "../../renderer/Renderer.h"
+#include "../../surface/PixelSurface.h"
+#include "../Texture.h"
+
+namespace stardust
+{
+	class TextureLoader
+		: private INoncopyable, private INonmovable
+	{
+	public:
+		using LoadCallback = std::function<void(Texture&& texture)>;
+		using DecodeCallback = std::function<void(PixelSurface&& surface)>;
+
+	private:
+		static constexpr float s_DefaultUploadTimeBudget = 0.004f;
+
+		const Renderer* m_renderer = nullptr;
+		vfs::AsyncReader* m_asyncReader = nullptr;
+
+		WorkerQueue<PixelSurface> m_decodeQueue;
+
+		std::unordered_map<std::uint64_t, vfs::AsyncReader::RequestID> m_pendingReads{ };
+		std::uint64_t m_nextReadID = 0u;
+
+		float m_uploadTimeBudget = s_DefaultUploadTimeBudget;
+
+	public:
+		[[nodiscard]] static unsigned int GetDefaultWorkerCount() noexcept;
+		[[nodiscard]] static PixelSurface DecodeImage(const std::string_view& filepath);
+		[[nodiscard]] static PixelSurface DecodeImage(const vfs::FileView& rawImageData);
+
+		TextureLoader() = default;
+		TextureLoader(const Renderer& renderer, vfs::AsyncReader& asyncReader, const unsigned int workerCount = GetDefaultWorkerCount());
+		~TextureLoader() noexcept;
+
+		void Initialise(const Renderer& renderer, vfs::AsyncReader& asyncReader, const unsigned int workerCount = GetDefaultWorkerCount());
+		void Destroy() noexcept;
+
+		void LoadAsync(const std::string_view& filepath, const LoadCallback& callback);
+		[[nodiscard]] std::future<Texture> LoadAsync(const std::string_view& filepath);
+		void DecodeAsync(const std::string_view& filepath, const DecodeCallback& callback);
+
+		void ProcessUploads();
+		void WaitForAll();
+
+		inline bool IsValid() const noexcept { return m_decodeQueue.IsValid(); }
+		inline bool IsIdle() const noexcept { return m_pendingReads.empty() && m_decodeQueue.IsIdle(); }
+		inline std::size_t GetPendingLoadCount() const noexcept { return m_pendingReads.size() + m_decodeQueue.GetPendingJobCount(); }
+
+		inline float GetUploadTimeBudget() const noexcept { return m_uploadTimeBudget; }
+		inline void SetUploadTimeBudget(const float uploadTimeBudget) noexcept { m_uploadTimeBudget = uploadTimeBudget; }
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,473 @@
+#include "TexturePacker.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <stb/stb_image_write.h>
+
+#include "../../../debug/logging/Log.h"
+#include "../../../utility/binary/Binary.h"
+#include "../../../vfs/VFS.h"
+#include "../texture_atlas/TextureAtlas.h"
+
+namespace stardust
+{
+	TexturePacker::TexturePacker(const glm::uvec2& pageSize, const unsigned int padding)
+	{
+		Initialise(pageSize, padding);
+	}
+
+	TexturePacker::TexturePacker(TexturePacker&& other) noexcept
+		: m_pageSize(glm::uvec2{ s_DefaultPageSize, s_DefaultPageSize }), m_padding(s_DefaultPadding), m_pendingImages(), m_placements(), m_pageSurfaces(), m_pages(), m_subtextures()
+	{
+		std::swap(m_pageSize, other.m_pageSize);
+		std::swap(m_padding, other.m_padding);
+
+		std::swap(m_pendingImages, other.m_pendingImages);
+		std::swap(m_placements, other.m_placements);
+		std::swap(m_pageSurfaces, other.m_pageSurfaces);
+
+		std::swap(m_pages, other.m_pages);
+		std::swap(m_subtextures, other.m_subtextures);
+	}
+
+	TexturePacker& TexturePacker::operator =(TexturePacker&& other) noexcept
+	{
+		m_pageSize = std::exchange(other.m_pageSize, glm::uvec2{ s_DefaultPageSize, s_DefaultPageSize });
+		m_padding = std::exchange(other.m_padding, s_DefaultPadding);
+
+		m_pendingImages = std::exchange(other.m_pendingImages, { });
+		m_placements = std::exchange(other.m_placements, { });
+		m_pageSurfaces = std::exchange(other.m_pageSurfaces, { });
+
+		m_pages = std::exchange(other.m_pages, { });
+		m_subtextures = std::exchange(other.m_subtextures, { });
+
+		return *this;
+	}
+
+	TexturePacker::~TexturePacker() noexcept
+	{
+		Destroy();
+	}
+
+	void TexturePacker::Initialise(const glm::uvec2& pageSize, const unsigned int padding)
+	{
+		m_pageSize = pageSize;
+		m_padding = padding;
+	}
+
+	void TexturePacker::Destroy() noexcept
+	{
+		m_pendingImages.clear();
+		m_placements.clear();
+		m_pageSurfaces.clear();
+
+		m_subtextures.clear();
+		m_pages.clear();
+	}
+
+	[[nodiscard]] Status TexturePacker::AddImage(const std::string& name, const std::string_view& filepath)
+	{
+		PixelSurface surface = TextureLoader::DecodeImage(filepath);
+
+		if (!surface.IsValid())
+		{
+			Log::EngineError("Failed to decode image {} for texture packing.", filepath);
+
+			return Status::Fail;
+		}
+
+		return AddImage(name, std::move(surface));
+	}
+
+	[[nodiscard]] Status TexturePacker::AddImage(const std::string& name, PixelSurface&& surface)
+	{
+		if (!surface.IsValid())
+		{
+			return Status::Fail;
+		}
+
+		const glm::uvec2 imageSize = surface.GetSize();
+
+		if (imageSize.x > m_pageSize.x || imageSize.y > m_pageSize.y)
+		{
+			Log::EngineError("Image {} ({}x{}) is too large to fit in a {}x{} texture page.", name, imageSize.x, imageSize.y, m_pageSize.x, m_pageSize.y);
+
+			return Status::Fail;
+		}
+
+		m_pendingImages.push_back(PendingImage{
+			.name = name,
+			.surface = std::move(surface),
+		});
+
+		return Status::Success;
+	}
+
+	[[nodiscard]] unsigned int TexturePacker::AddDirectory(const std::string_view& directory)
+	{
+		unsigned int addedImageCount = 0u;
+
+		for (const auto& filepath : vfs::GetAllFilesInDirectory(directory))
+		{
+			if (AddImage(vfs::GetFileStem(filepath), filepath) == Status::Success)
+			{
+				++addedImageCount;
+			}
+		}
+
+		return addedImageCount;
+	}
+
+	[[nodiscard]] unsigned int TexturePacker::AddDirectory(const std::string_view& directory, TextureLoader& textureLoader)
+	{
+		if (!textureLoader.IsValid())
+		{
+			return AddDirectory(directory);
+		}
+
+		unsigned int addedImageCount = 0u;
+
+		for (const auto& filepath : vfs::GetAllFilesInDirectory(directory))
+		{
+			textureLoader.DecodeAsync(filepath, [this, &addedImageCount, filepath](PixelSurface&& surface)
+			{
+				if (!surface.IsValid())
+				{
+					Log::EngineError("Failed to decode image {} for texture packing.", filepath);
+
+					return;
+				}
+
+				if (AddImage(vfs::GetFileStem(filepath), std::move(surface)) == Status::Success)
+				{
+					++addedImageCount;
+				}
+			});
+		}
+
+		textureLoader.WaitForAll();
+
+		return addedImageCount;
+	}
+
+	[[nodiscard]] Status TexturePacker::Pack()
+	{
+		if (m_pendingImages.empty())
+		{
+			return Status::Fail;
+		}
+
+		std::stable_sort(std::begin(m_pendingImages), std::end(m_pendingImages), [](const PendingImage& lhs, const PendingImage& rhs)
+		{
+			const glm::uvec2 lhsSize = lhs.surface.GetSize();
+			const glm::uvec2 rhsSize = rhs.surface.GetSize();
+
+			const unsigned int lhsLongSide = std::max(lhsSize.x, lhsSize.y);
+			const unsigned int rhsLongSide = std::max(rhsSize.x, rhsSize.y);
+
+			if (lhsLongSide != rhsLongSide)
+			{
+				return lhsLongSide > rhsLongSide;
+			}
+
+			if (lhsSize.x * lhsSize.y != rhsSize.x * rhsSize.y)
+			{
+				return lhsSize.x * lhsSize.y > rhsSize.x * rhsSize.y;
+			}
+
+			return lhs.name < rhs.name;
+		});
+
+		std::vector<Page> pages{ };
+		m_placements.clear();
+		m_placements.reserve(m_pendingImages.size());
+
+		for (const auto& pendingImage : m_pendingImages)
+		{
+			const glm::uvec2 imageSize = pendingImage.surface.GetSize();
+			const glm::uvec2 paddedSize = imageSize + glm::uvec2{ m_padding, m_padding };
+
+			std::optional<rect::Rect> placementArea = std::nullopt;
+			std::size_t pageIndex = 0u;
+
+			for (; pageIndex < pages.size(); ++pageIndex)
+			{
+				placementArea = FindPlacement(pages[pageIndex], paddedSize);
+
+				if (placementArea.has_value())
+				{
+					break;
+				}
+			}
+
+			if (!placementArea.has_value())
+			{
+				pages.push_back(Page{
+					.freeAreas = { rect::Create(0, 0, m_pageSize.x + m_padding, m_pageSize.y + m_padding) },
+					.usedSize = glm::uvec2{ 0u, 0u },
+				});
+
+				pageIndex = pages.size() - 1u;
+				placementArea = FindPlacement(pages[pageIndex], paddedSize);
+			}
+
+			Page& page = pages[pageIndex];
+			SplitFreeAreas(page, placementArea.value());
+			PruneFreeAreas(page);
+
+			page.usedSize.x = std::max(page.usedSize.x, static_cast<unsigned int>(placementArea->x) + imageSize.x);
+			page.usedSize.y = std::max(page.usedSize.y, static_cast<unsigned int>(placementArea->y) + imageSize.y);
+
+			m_placements.push_back(Placement{
+				.name = pendingImage.name,
+				.pageIndex = pageIndex,
+				.area = rect::Create(placementArea->x, placementArea->y, imageSize.x, imageSize.y),
+			});
+		}
+
+		m_pageSurfaces.clear();
+		m_pageSurfaces.reserve(pages.size());
+
+		for (const auto& page : pages)
+		{
+			m_pageSurfaces.emplace_back(page.usedSize.x, page.usedSize.y, 4u);
+
+			if (!m_pageSurfaces.back().IsValid())
+			{
+				m_pageSurfaces.clear();
+				m_placements.clear();
+
+				return Status::Fail;
+			}
+		}
+
+		for (std::size_t i = 0u; i < m_placements.size(); ++i)
+		{
+			const Placement& placement = m_placements[i];
+			const PixelSurface& imageSurface = m_pendingImages[i].surface;
+
+			SDL_SetSurfaceBlendMode(imageSurface.GetRawHandle(), SDL_BLENDMODE_NONE);
+			m_pageSurfaces[placement.pageIndex].Blit(imageSurface, std::nullopt, rect::Create(placement.area.x, placement.area.y));
+		}
+
+		Log::EngineTrace("Packed {} images into {} texture page(s).", m_pendingImages.size(), m_pageSurfaces.size());
+		m_pendingImages.clear();
+
+		return Status::Success;
+	}
+
+	[[nodiscard]] Status TexturePacker::Upload(const Renderer& renderer)
+	{
+		if (m_pageSurfaces.empty())
+		{
+			return Status::Fail;
+		}
+
+		m_subtextures.clear();
+		m_pages.clear();
+		m_pages.reserve(m_pageSurfaces.size());
+
+		for (const auto& pageSurface : m_pageSurfaces)
+		{
+			m_pages.emplace_back(renderer, pageSurface.GetRawHandle());
+
+			if (!m_pages.back().IsValid())
+			{
+				m_pages.clear();
+
+				return Status::Fail;
+			}
+		}
+
+		for (const auto& placement : m_placements)
+		{
+			m_subtextures[StringID::Intern(placement.name)] = Subtexture{
+				.texture = &m_pages[placement.pageIndex],
+				.area = placement.area,
+			};
+		}
+
+		m_pageSurfaces.clear();
+		m_placements.clear();
+
+		return Status::Success;
+	}
+
+	[[nodiscard]] Status TexturePacker::WriteToDirectory(const std::filesystem::path& directory, const std::string& atlasName) const
+	{
+		if (m_pageSurfaces.empty())
+		{
+			Log::EngineError("Texture pages must be packed and not yet uploaded before they can be written.");
+
+			return Status::Fail;
+		}
+
+		std::error_code errorCode;
+		std::filesystem::create_directories(directory, errorCode);
+
+		for (std::size_t pageIndex = 0u; pageIndex < m_pageSurfaces.size(); ++pageIndex)
+		{
+			const std::string pageName = m_pageSurfaces.size() == 1u ? atlasName : atlasName + "_" + std::to_string(pageIndex);
+			const std::string textureFilename = pageName + ".png";
+
+			const PixelSurface& pageSurface = m_pageSurfaces[pageIndex];
+			const bool wasTextureWritten = stbi_write_png(
+				(directory / textureFilename).string().c_str(),
+				static_cast<int>(pageSurface.GetSize().x),
+				static_cast<int>(pageSurface.GetSize().y),
+				4,
+				pageSurface.GetPixels(),
+				static_cast<int>(pageSurface.GetPitch())
+			) != 0;
+
+			if (!wasTextureWritten)
+			{
+				return Status::Fail;
+			}
+
+			std::vector<std::string> subtextureNames{ };
+			std::vector<rect::Rect> subtextureRects{ };
+
+			for (const auto& placement : m_placements)
+			{
+				if (placement.pageIndex == pageIndex)
+				{
+					subtextureNames.push_back(placement.name);
+					subtextureRects.push_back(placement.area);
+				}
+			}
+
+			std::vector<std::byte> textureAtlasData{ };
+
+			if (TextureAtlas::SerialiseBinary(textureFilename, subtextureNames, subtextureRects, textureAtlasData) == Status::Fail)
+			{
+				return Status::Fail;
+			}
+
+			if (binary::WriteToFile(directory / (pageName + TextureAtlas::BinaryFileExtension), textureAtlasData) == Status::Fail)
+			{
+				return Status::Fail;
+			}
+		}
+
+		return Status::Success;
+	}
+
+	[[nodiscard]] std::optional<TexturePacker::Subtexture> TexturePacker::GetSubtexture(const StringID name) const
+	{
+		if (const auto subtextureLocation = m_subtextures.find(name);
+			subtextureLocation != std::cend(m_subtextures))
+		{
+			return subtextureLocation->second;
+		}
+
+		return std::nullopt;
+	}
+
+	[[nodiscard]] std::optional<rect::Rect> TexturePacker::FindPlacement(const Page& page, const glm::uvec2& paddedSize) const
+	{
+		std::optional<rect::Rect> bestArea = std::nullopt;
+		int bestShortSideFit = std::numeric_limits<int>::max();
+		int bestLongSideFit = std::numeric_limits<int>::max();
+
+		for (const auto& freeArea : page.freeAreas)
+		{
+			const int leftoverWidth = freeArea.w - static_cast<int>(paddedSize.x);
+			const int leftoverHeight = freeArea.h - static_cast<int>(paddedSize.y);
+
+			if (leftoverWidth < 0 || leftoverHeight < 0)
+			{
+				continue;
+			}
+
+			const int shortSideFit = std::min(leftoverWidth, leftoverHeight);
+			const int longSideFit = std::max(leftoverWidth, leftoverHeight);
+
+			if (shortSideFit < bestShortSideFit || (shortSideFit == bestShortSideFit && longSideFit < bestLongSideFit))
+			{
+				bestArea = rect::Create(freeArea.x, freeArea.y, paddedSize.x, paddedSize.y);
+				bestShortSideFit = shortSideFit;
+				bestLongSideFit = longSideFit;
+			}
+		}
+
+		return bestArea;
+	}
+
+	void TexturePacker::SplitFreeAreas(Page& page, const rect::Rect& usedArea)
+	{
+		std::vector<rect::Rect> splitAreas{ };
+
+		for (auto freeAreaIterator = std::begin(page.freeAreas); freeAreaIterator != std::end(page.freeAreas);)
+		{
+			const rect::Rect freeArea = *freeAreaIterator;
+
+			if (!rect::HasIntersection(freeArea, usedArea))
+			{
+				++freeAreaIterator;
+
+				continue;
+			}
+
+			if (usedArea.x > freeArea.x)
+			{
+				splitAreas.push_back(rect::Rect{ freeArea.x, freeArea.y, usedArea.x - freeArea.x, freeArea.h });
+			}
+
+			if (usedArea.x + usedArea.w < freeArea.x + freeArea.w)
+			{
+				splitAreas.push_back(rect::Rect{ usedArea.x + usedArea.w, freeArea.y, freeArea.x + freeArea.w - (usedArea.x + usedArea.w), freeArea.h });
+			}
+
+			if (usedArea.y > freeArea.y)
+			{
+				splitAreas.push_back(rect::Rect{ freeArea.x, freeArea.y, freeArea.w, usedArea.y - freeArea.y });
+			}
+
+			if (usedArea.y + usedArea.h < freeArea.y + freeArea.h)
+			{
+				splitAreas.push_back(rect::Rect{ freeArea.x, usedArea.y + usedArea.h, freeArea.w, freeArea.y + freeArea.h - (usedArea.y + usedArea.h) });
+			}
+
+			freeAreaIterator = page.freeAreas.erase(freeAreaIterator);
+		}
+
+		page.freeAreas.insert(std::end(page.freeAreas), std::begin(splitAreas), std::end(splitAreas));
+	}
+
+	void TexturePacker::PruneFreeAreas(Page& page)
+	{
+		const auto isContainedIn = [](const rect::Rect& inner, const rect::Rect& outer)
+		{
+			return inner.x >= outer.x && inner.y >= outer.y
+				&& inner.x + inner.w <= outer.x + outer.w
+				&& inner.y + inner.h <= outer.y + outer.h;
+		};
+
+		for (std::size_t i = 0u; i < page.freeAreas.size(); ++i)
+		{
+			for (std::size_t j = i + 1u; j < page.freeAreas.size(); ++j)
+			{
+				if (isContainedIn(page.freeAreas[i], page.freeAreas[j]))
+				{
+					page.freeAreas.erase(std::begin(page.freeAreas) + static_cast<std::ptrdiff_t>(i));
+					--i;
+
+					break;
+				}
+
+				if (isContainedIn(page.freeAreas[j], page.freeAreas[i]))
+				{
+					page.freeAreas.erase(std::begin(page.freeAreas) + static_cast<std::ptrdiff_t>(j));
+					--j;
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
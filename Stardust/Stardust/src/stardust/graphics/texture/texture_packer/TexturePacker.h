@@ -0,0 +1,114 @@
+#pragma once
+#ifndef TEXTURE_PACKER_H
+#define TEXTURE_PACKER_H
+
+#include "../../../utility/interfaces/INoncopyable.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../../../rect/Rect.h"
+#include "../../../utility/enums/Status.h"
+#include "../../../utility/string_id/StringID.h"
+#include "../../renderer/Renderer.h"
+#include "../../surface/PixelSurface.h"
+#include "../texture_loader/TextureLoader.h"
+#include "../Texture.h"
+
+namespace stardust
+{
+	class TexturePacker
+		: private INoncopyable
+	{
+	public:
+		struct Subtexture
+		{
+			Texture* texture;
+			rect::Rect area;
+		};
+
+	private:
+		struct PendingImage
+		{
+			std::string name;
+			PixelSurface surface;
+		};
+
+		struct Placement
+		{
+			std::string name;
+			std::size_t pageIndex;
+			rect::Rect area;
+		};
+
+		struct Page
+		{
+			std::vector<rect::Rect> freeAreas;
+			glm::uvec2 usedSize;
+		};
+
+		static constexpr unsigned int s_DefaultPageSize = 2048u;
+		static constexpr unsigned int s_DefaultPadding = 1u;
+
+		glm::uvec2 m_pageSize{ s_DefaultPageSize, s_DefaultPageSize };
+		unsigned int m_padding = s_DefaultPadding;
+
+		std::vector<PendingImage> m_pendingImages{ };
+		std::vector<Placement> m_placements{ };
+		std::vector<PixelSurface> m_pageSurfaces{ };
+
+		std::vector<Texture> m_pages{ };
+		std::unordered_map<StringID, Subtexture> m_subtextures{ };
+
+	public:
+		TexturePacker() = default;
+		explicit TexturePacker(const glm::uvec2& pageSize, const unsigned int padding = s_DefaultPadding);
+
+		TexturePacker(TexturePacker&& other) noexcept;
+		TexturePacker& operator =(TexturePacker&& other) noexcept;
+
+		~TexturePacker() noexcept;
+
+		void Initialise(const glm::uvec2& pageSize, const unsigned int padding = s_DefaultPadding);
+		void Destroy() noexcept;
+
+		[[nodiscard]] Status AddImage(const std::string& name, const std::string_view& filepath);
+		[[nodiscard]] Status AddImage(const std::string& name, PixelSurface&& surface);
+		[[nodiscard]] unsigned int AddDirectory(const std::string_view& directory);
+		[[nodiscard]] unsigned int AddDirectory(const std::string_view& directory, TextureLoader& textureLoader);
+
+		[[nodiscard]] Status Pack();
+		[[nodiscard]] Status Upload(const Renderer& renderer);
+		[[nodiscard]] Status WriteToDirectory(const std::filesystem::path& directory, const std::string& atlasName) const;
+
+		[[nodiscard]] std::optional<Subtexture> GetSubtexture(const StringID name) const;
+		inline const Subtexture& operator [](const StringID name) const { return m_subtextures.at(name); }
+
+		inline bool HasSubtexture(const StringID name) const { return m_subtextures.contains(name); }
+		inline std::size_t GetSubtextureCount() const noexcept { return m_subtextures.size(); }
+		inline std::size_t GetPendingImageCount() const noexcept { return m_pendingImages.size(); }
+
+		inline std::size_t GetPageCount() const noexcept { return m_pages.size(); }
+		inline Texture& GetPage(const std::size_t index) { return m_pages.at(index); }
+		inline const Texture& GetPage(const std::size_t index) const { return m_pages.at(index); }
+		inline std::vector<Texture>& GetPages() noexcept { return m_pages; }
+		inline const std::vector<Texture>& GetPages() const noexcept { return m_pages; }
+
+		inline const glm::uvec2& GetPageSize() const noexcept { return m_pageSize; }
+		inline unsigned int GetPadding() const noexcept { return m_padding; }
+
+	private:
+		[[nodiscard]] std::optional<rect::Rect> FindPlacement(const Page& page, const glm::uvec2& paddedSize) const;
+		static void SplitFreeAreas(Page& page, const rect::Rect& usedArea);
+		static void PruneFreeAreas(Page& page);
+	};
+}
+
+#endif
\ No newline at end of file
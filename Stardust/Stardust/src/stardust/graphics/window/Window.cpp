@@ -196,9 +196,9 @@ namespace stardust
 
 	void Window::SetIcon(const std::string_view& iconFilepath, const Locale& locale) const
 	{
-		const std::vector<std::byte> rawIconData = vfs::ReadFileData(iconFilepath);
+		const vfs::FileView rawIconData = vfs::ReadFileView(iconFilepath);
 
-		if (rawIconData.empty())
+		if (rawIconData.IsEmpty())
 		{
 			message_box::Show(locale["warnings"]["titles"]["window"], locale["warnings"]["bodies"]["window-icon-load"], message_box::Type::Warning);
 			Log::EngineWarn("Failed to open window icon file at {}.", iconFilepath);
@@ -208,7 +208,7 @@ namespace stardust
 
 		int iconWidth = 0;
 		int iconHeight = 0;
-		stbi_uc* iconData = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(rawIconData.data()), static_cast<int>(rawIconData.size()), &iconWidth, &iconHeight, nullptr, STBI_rgb_alpha);
+		stbi_uc* iconData = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(rawIconData.GetData()), static_cast<int>(rawIconData.GetSize()), &iconWidth, &iconHeight, nullptr, STBI_rgb_alpha);
 
 		if (iconData == nullptr)
 		{
@@ -276,4 +276,4 @@ namespace stardust
 			return std::get<int>(windowCoordinate);
 		}
 	}
-}
+}
\ No newline at end of file
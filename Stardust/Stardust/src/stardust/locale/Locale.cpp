@@ -16,19 +16,72 @@ namespace stardust
 
 	[[nodiscard]] Status Locale::SetLocale(const std::string_view& localeName)
 	{
-		const std::string engineLocaleFilepath = m_engineLocaleDirectory + "/" + std::string(localeName) + ".json";
-		auto localeAccumulator = LoadLocaleFile(engineLocaleFilepath);
+		const vfs::FileView engineLocaleData = vfs::ReadFileView(GetEngineLocaleFilepath(localeName));
+		const std::string clientLocaleFilepath = GetClientLocaleFilepath(localeName);
+
+		if (!vfs::DoesFileExist(clientLocaleFilepath))
+		{
+			return ApplyLocale(localeName, engineLocaleData, nullptr);
+		}
+
+		const vfs::FileView clientLocaleData = vfs::ReadFileView(clientLocaleFilepath);
+
+		return ApplyLocale(localeName, engineLocaleData, &clientLocaleData);
+	}
+
+	[[nodiscard]] Status Locale::SetLocale(const std::string_view& localeName, vfs::AsyncReader& asyncReader)
+	{
+		if (!asyncReader.IsValid())
+		{
+			return SetLocale(localeName);
+		}
+
+		const std::string clientLocaleFilepath = GetClientLocaleFilepath(localeName);
+		const bool hasClientLocale = vfs::DoesFileExist(clientLocaleFilepath);
+
+		vfs::FileView engineLocaleData;
+		vfs::FileView clientLocaleData;
+
+		asyncReader.Read(GetEngineLocaleFilepath(localeName), [&engineLocaleData](vfs::FileView&& fileView)
+		{
+			engineLocaleData = std::move(fileView);
+		}, vfs::AsyncReader::Priority::Critical);
+
+		if (hasClientLocale)
+		{
+			asyncReader.Read(clientLocaleFilepath, [&clientLocaleData](vfs::FileView&& fileView)
+			{
+				clientLocaleData = std::move(fileView);
+			}, vfs::AsyncReader::Priority::Critical);
+		}
+
+		asyncReader.WaitForAll();
+
+		return ApplyLocale(localeName, engineLocaleData, hasClientLocale ? &clientLocaleData : nullptr);
+	}
+
+	[[nodiscard]] std::string Locale::GetEngineLocaleFilepath(const std::string_view& localeName) const
+	{
+		return m_engineLocaleDirectory + "/" + std::string(localeName) + ".json";
+	}
+
+	[[nodiscard]] std::string Locale::GetClientLocaleFilepath(const std::string_view& localeName) const
+	{
+		return m_clientLocaleDirectory + "/" + std::string(localeName) + ".json";
+	}
+
+	[[nodiscard]] Status Locale::ApplyLocale(const std::string_view& localeName, const vfs::FileView& engineLocaleData, const vfs::FileView* const clientLocaleData)
+	{
+		auto localeAccumulator = ParseLocaleData(engineLocaleData);
 
 		if (!localeAccumulator.has_value())
 		{
 			return Status::Fail;
 		}
 
-		const std::string clientLocaleFilepath = m_clientLocaleDirectory + "/" + std::string(localeName) + ".json";
-
-		if (vfs::DoesFileExist(clientLocaleFilepath))
+		if (clientLocaleData != nullptr)
 		{
-			const auto clientLocale = LoadLocaleFile(clientLocaleFilepath);
+			const auto clientLocale = ParseLocaleData(*clientLocaleData);
 
 			if (!clientLocale.has_value())
 			{
@@ -46,21 +99,26 @@ namespace stardust
 		m_currentLocale = std::move(*localeAccumulator);
 		m_currentLocaleName = localeName;
 
+		m_localeStrings.clear();
+
+		for (const auto& localeItem : m_currentLocale.items())
+		{
+			m_localeStrings[StringID::Intern(localeItem.key())] = &localeItem.value();
+		}
+
 		return Status::Success;
 	}
 
-	[[nodiscard]] std::optional<nlohmann::json> Locale::LoadLocaleFile(const std::string& filepath) const
+	[[nodiscard]] std::optional<nlohmann::json> Locale::ParseLocaleData(const vfs::FileView& localeData) const
 	{
-		const std::vector<std::byte> localeData = vfs::ReadFileData(filepath);
-
-		if (localeData.empty())
+		if (localeData.IsEmpty())
 		{
 			return std::nullopt;
 		}
 
 		const nlohmann::json locale = nlohmann::json::parse(
-			reinterpret_cast<const unsigned char*>(localeData.data()),
-			reinterpret_cast<const unsigned char*>(localeData.data()) + localeData.size(),
+			reinterpret_cast<const unsigned char*>(localeData.GetData()),
+			reinterpret_cast<const unsigned char*>(localeData.GetData()) + localeData.GetSize(),
 			nullptr,
 			false
 		);
@@ -2,17 +2,25 @@
 #ifndef LOCALE_H
 #define LOCALE_H
 
+#include "../utility/interfaces/INoncopyable.h"
+#include "../utility/interfaces/INonmovable.h"
+
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include <nlohmann/json.hpp>
 
 #include "../utility/enums/Status.h"
+#include "../utility/string_id/StringID.h"
+#include "../vfs/AsyncReader.h"
+#include "../vfs/FileView.h"
 
 namespace stardust
 {
 	class Locale
+		: private INoncopyable, private INonmovable
 	{
 	private:
 		std::string m_engineLocaleDirectory;
@@ -20,6 +28,7 @@ namespace stardust
 
 		nlohmann::json m_currentLocale;
 		std::string m_currentLocaleName;
+		std::unordered_map<StringID, const nlohmann::json*> m_localeStrings{ };
 
 	public:
 		Locale() = default;
@@ -27,12 +36,17 @@ namespace stardust
 
 		void Initialise(const std::string_view& engineLocaleDirectory, const std::string_view& clientLocaleDirectory);
 		[[nodiscard]] Status SetLocale(const std::string_view& localeName);
+		[[nodiscard]] Status SetLocale(const std::string_view& localeName, vfs::AsyncReader& asyncReader);
 
 		inline const std::string& GetCurrentLocaleName() const noexcept { return m_currentLocaleName; }
-		inline const nlohmann::json& operator [](const std::string_view& localeString) const { return m_currentLocale[localeString.data()]; }
+		inline const nlohmann::json& operator [](const StringID localeString) const { return *m_localeStrings.at(localeString); }
 
 	private:
-		[[nodiscard]] std::optional<nlohmann::json> LoadLocaleFile(const std::string& filepath) const;
+		[[nodiscard]] std::string GetEngineLocaleFilepath(const std::string_view& localeName) const;
+		[[nodiscard]] std::string GetClientLocaleFilepath(const std::string_view& localeName) const;
+
+		[[nodiscard]] Status ApplyLocale(const std::string_view& localeName, const vfs::FileView& engineLocaleData, const vfs::FileView* const clientLocaleData);
+		[[nodiscard]] std::optional<nlohmann::json> ParseLocaleData(const vfs::FileView& localeData) const;
 	};
 }
 
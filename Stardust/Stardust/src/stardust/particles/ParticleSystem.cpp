@@ -61,6 +61,13 @@ namespace stardust
 
 	void ParticleSystem::Render(const Renderer& renderer) const
 	{
+		if (!m_primitiveBatch.IsValid() || &m_primitiveBatch.GetRenderer() != &renderer)
+		{
+			m_primitiveBatch.Initialise(renderer);
+		}
+
+		m_primitiveBatch.Begin();
+
 		for (const auto& [particleID, particle] : m_activeParticles)
 		{
 			if (!particle->isActive)
@@ -77,10 +84,12 @@ namespace stardust
 
 			if (particle->texture == nullptr)
 			{
-				renderer.DrawRect(sourceRect, particle->currentColour);
+				m_primitiveBatch.DrawRect(sourceRect, particle->currentColour);
 			}
 			else
 			{
+				m_primitiveBatch.Flush();
+
 				const auto [originalRed, originalGreen, originalBlue] = particle->texture->GetColourMod();
 				const std::uint8_t originalAlpha = particle->texture->GetAlphaMod();
 
@@ -101,6 +110,8 @@ namespace stardust
 				particle->texture->SetAlphaMod(originalAlpha);
 			}
 		}
+
+		m_primitiveBatch.End();
 	}
 
 	void ParticleSystem::Emit(const ParticleData& particleData)
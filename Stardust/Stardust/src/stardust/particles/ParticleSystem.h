@@ -10,6 +10,7 @@
 #include <glm/glm.hpp>
 
 #include "../graphics/Colour.h"
+#include "../graphics/renderer/primitive_batch/PrimitiveBatch.h"
 #include "../graphics/renderer/Renderer.h"
 #include "../graphics/texture/Texture.h"
 #include "../rect/Rect.h"
@@ -86,6 +87,8 @@ namespace stardust
 
 		glm::vec2 m_gravity = glm::vec2{ 0.0f, 0.0f };
 
+		mutable PrimitiveBatch m_primitiveBatch;
+
 	public:
 		static constexpr std::size_t GetMaxParticleCount() noexcept { return s_ParticleCount; }
 
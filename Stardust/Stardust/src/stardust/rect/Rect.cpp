@@ -24,6 +24,11 @@ namespace stardust
 			return static_cast<bool>(SDL_RectEmpty(&rect));
 		}
 
+		[[nodiscard]] bool AreEqual(const Rect& a, const Rect& b)
+		{
+			return static_cast<bool>(SDL_RectEquals(&a, &b));
+		}
+
 		[[nodiscard]] unsigned int GetArea(const Rect& rect)
 		{
 			return rect.w * rect.h;
@@ -21,6 +21,7 @@ namespace stardust
 		[[nodiscard]] Line Create(const Point& firstPoint, const Point& secondPoint);
 
 		[[nodiscard]] bool IsEmpty(const Rect& rect);
+		[[nodiscard]] extern bool AreEqual(const Rect& a, const Rect& b);
 		[[nodiscard]] extern unsigned int GetArea(const Rect& rect);
 
 		[[nodiscard]] extern bool IsAnyPointEnclosed(const std::vector<Point>& points, const Rect& clippingRect);
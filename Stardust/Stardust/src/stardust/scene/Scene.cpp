@@ -6,7 +6,7 @@
 namespace stardust
 {
 	Scene::Scene(Application& application, const std::string& name)
-		: m_name(name), m_application(application), m_entityRegistry(application.GetEntityRegistry())
+		: m_name(name), m_application(application), m_entityRegistry(application.GetEntityRegistry()), m_assets(application)
 	{ }
 
 	Entity Scene::CreateEntity()
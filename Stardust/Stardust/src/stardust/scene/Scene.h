@@ -11,6 +11,7 @@
 #include <glm/glm.hpp>
 #include <SDL2/SDL.h>
 
+#include "../assets/AssetSet.h"
 #include "../input/KeyCode.h"
 #include "../input/Input.h"
 #include "../graphics/renderer/Renderer.h"
@@ -27,6 +28,7 @@ namespace stardust
 	protected:
 		class Application& m_application;
 		entt::registry& m_entityRegistry;
+		AssetSet m_assets;
 
 	public:
 		Scene(class Application& application, const std::string& name);
@@ -55,6 +57,8 @@ namespace stardust
 		virtual void Render(const Renderer& renderer) const = 0;
 
 		inline entt::registry& GetEntityRegistry() noexcept { return m_entityRegistry; }
+		inline AssetSet& GetAssets() noexcept { return m_assets; }
+		inline const AssetSet& GetAssets() const noexcept { return m_assets; }
 		inline const std::string& GetName() const noexcept { return m_name; }
 
 	protected:
@@ -6,4 +6,12 @@ namespace stardust
 	{
 		m_scenes.pop();
 	}
+
+	[[nodiscard]] std::unique_ptr<Scene> SceneManager::ReleaseCurrentScene()
+	{
+		std::unique_ptr<Scene> currentScene = std::move(m_scenes.front());
+		m_scenes.pop();
+
+		return currentScene;
+	}
 }
\ No newline at end of file
@@ -27,6 +27,7 @@ namespace stardust
 		}
 
 		void PopScene();
+		[[nodiscard]] std::unique_ptr<Scene> ReleaseCurrentScene();
 
 		inline const std::unique_ptr<Scene>& CurrentScene() const { return m_scenes.front(); }
 		inline bool IsEmpty() const noexcept { return m_scenes.empty(); }
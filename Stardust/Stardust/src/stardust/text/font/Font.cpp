@@ -18,16 +18,27 @@ namespace stardust
 		Initialise(fontFilepath, pointSize);
 	}
 
+	Font::Font(vfs::FileView&& fontFileView, const unsigned int pointSize)
+	{
+		Initialise(std::move(fontFileView), pointSize);
+	}
+
 	Font::Font(Font&& other) noexcept
-		: m_handle(nullptr), m_pointSize(0u)
+		: m_handle(nullptr), m_fontFileView(), m_fontFileRWOps(nullptr), m_pointSize(0u)
 	{
 		std::swap(m_handle, other.m_handle);
+		std::swap(m_fontFileView, other.m_fontFileView);
+		std::swap(m_fontFileRWOps, other.m_fontFileRWOps);
 		std::swap(m_pointSize, other.m_pointSize);
 	}
 
 	Font& Font::operator =(Font&& other) noexcept
 	{
+		Destroy();
+
 		m_handle = std::exchange(other.m_handle, nullptr);
+		m_fontFileView = std::exchange(other.m_fontFileView, vfs::FileView());
+		m_fontFileRWOps = std::exchange(other.m_fontFileRWOps, nullptr);
 		m_pointSize = std::exchange(other.m_pointSize, 0u);
 
 		return *this;
@@ -40,18 +51,37 @@ namespace stardust
 
 	void Font::Initialise(const std::string_view& fontFilepath, const unsigned int pointSize)
 	{
-		m_fontFileData = vfs::ReadFileData(fontFilepath);
+		m_fontFileView = vfs::MapFileView(fontFilepath);
 		
-		if (m_fontFileData.empty())
+		if (m_fontFileView.IsValid())
 		{
-			return;
+			m_fontFileRWOps = SDL_RWFromConstMem(m_fontFileView.GetData(), static_cast<int>(m_fontFileView.GetSize()));
 		}
-		
-		m_fontFileRWOps = SDL_RWFromConstMem(m_fontFileData.data(), static_cast<int>(m_fontFileData.size()));
-		
+		else
+		{
+			m_fontFileRWOps = vfs::Stream::OpenRWops(fontFilepath);
+		}
+
+		OpenFontFromRWops(pointSize);
+	}
+
+	void Font::Initialise(vfs::FileView&& fontFileView, const unsigned int pointSize)
+	{
+		m_fontFileView = std::move(fontFileView);
+
+		if (!m_fontFileView.IsEmpty())
+		{
+			m_fontFileRWOps = SDL_RWFromConstMem(m_fontFileView.GetData(), static_cast<int>(m_fontFileView.GetSize()));
+		}
+
+		OpenFontFromRWops(pointSize);
+	}
+
+	void Font::OpenFontFromRWops(const unsigned int pointSize)
+	{
 		if (m_fontFileRWOps == nullptr)
 		{
-			m_fontFileData.clear();
+			m_fontFileView.Destroy();
 
 			return;
 		}
@@ -66,7 +96,7 @@ namespace stardust
 		{
 			SDL_RWclose(m_fontFileRWOps);
 			m_fontFileRWOps = nullptr;
-			m_fontFileData.clear();
+			m_fontFileView.Destroy();
 		}
 	}
 
@@ -78,12 +108,22 @@ namespace stardust
 
 			SDL_RWclose(m_fontFileRWOps);
 			m_fontFileRWOps = nullptr;
-			m_fontFileData.clear();
+			m_fontFileView.Destroy();
 
 			m_pointSize = 0u;
 		}
 	}
 
+	[[nodiscard]] std::size_t Font::GetMemoryUsage() const noexcept
+	{
+		if (m_handle == nullptr)
+		{
+			return 0u;
+		}
+
+		return m_fontFileView.IsValid() ? m_fontFileView.GetSize() : vfs::Stream::DefaultBufferSize;
+	}
+
 	[[nodiscard]] std::vector<Font::Style> Font::GetStyles() const
 	{
 		constexpr std::array<Style, 4u> AllFontStyles{
@@ -14,6 +14,8 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 
+#include "../../vfs/FileView.h"
+
 namespace stardust
 {
 	class Font
@@ -54,7 +56,7 @@ namespace stardust
 		};
 
 		std::unique_ptr<TTF_Font, FontDestroyer> m_handle = nullptr;
-		std::vector<std::byte> m_fontFileData{ };
+		vfs::FileView m_fontFileView;
 		SDL_RWops* m_fontFileRWOps = nullptr;
 
 		unsigned int m_pointSize = 0u;
@@ -62,6 +64,7 @@ namespace stardust
 	public:
 		Font() = default;
 		Font(const std::string_view& fontFilepath, const unsigned int pointSize);
+		Font(vfs::FileView&& fontFileView, const unsigned int pointSize);
 
 		Font(Font&& other) noexcept;
 		Font& operator =(Font&& other) noexcept;
@@ -69,9 +72,11 @@ namespace stardust
 		~Font() noexcept;
 
 		void Initialise(const std::string_view& fontFilepath, const unsigned int pointSize);
+		void Initialise(vfs::FileView&& fontFileView, const unsigned int pointSize);
 		void Destroy() noexcept;
 
 		inline bool IsValid() const noexcept { return m_handle != nullptr; }
+		[[nodiscard]] std::size_t GetMemoryUsage() const noexcept;
 
 		[[nodiscard]] std::vector<Style> GetStyles() const;
 		void SetStyles(const std::vector<Style>& styles) const;
@@ -103,6 +108,9 @@ namespace stardust
 		[[nodiscard]] glm::uvec2 GetTextSize(const std::u16string& text) const;
 
 		[[nodiscard]] inline TTF_Font* const GetRawHandle() const noexcept { return m_handle.get(); }
+
+	private:
+		void OpenFontFromRWops(const unsigned int pointSize);
 	};
 }
 
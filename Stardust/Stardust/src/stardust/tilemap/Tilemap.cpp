@@ -0,0 +1,576 @@
+#include "Tilemap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "../debug/logging/Log.h"
+#include "../graphics/Colour.h"
+#include "../utility/binary/Binary.h"
+#include "../vfs/VFS.h"
+
+namespace stardust
+{
+	Tilemap::Tilemap(const Renderer& renderer, const TextureAtlas& textureAtlas, const std::string_view& filepath)
+	{
+		Initialise(renderer, textureAtlas, filepath);
+	}
+
+	Tilemap::Tilemap(const Renderer& renderer, const TextureAtlas& textureAtlas, const std::vector<std::string>& tileNames, const glm::uvec2& size, const glm::uvec2& tilePixelSize)
+	{
+		Initialise(renderer, textureAtlas, tileNames, size, tilePixelSize);
+	}
+
+	Tilemap::Tilemap(Tilemap&& other) noexcept
+		: m_renderer(nullptr), m_textureAtlas(nullptr), m_size(glm::uvec2{ 0u, 0u }), m_tilePixelSize(glm::uvec2{ 0u, 0u }), m_tiles({ }), m_tileNames({ }), m_tileRects({ }),
+		  m_position(glm::vec2{ 0.0f, 0.0f }), m_tileWorldSize(1.0f), m_chunkCount(glm::uvec2{ 0u, 0u }), m_chunks({ }), m_chunkTextures(), m_chunkTextureOwners({ }),
+		  m_maxCachedChunkCount(s_DefaultMaxCachedChunkCount), m_frameIndex(0u), m_chunkRebuildCount(0u), m_visibleChunkCount(0u)
+	{
+		std::swap(m_renderer, other.m_renderer);
+		std::swap(m_textureAtlas, other.m_textureAtlas);
+
+		std::swap(m_size, other.m_size);
+		std::swap(m_tilePixelSize, other.m_tilePixelSize);
+		std::swap(m_tiles, other.m_tiles);
+
+		std::swap(m_tileNames, other.m_tileNames);
+		std::swap(m_tileRects, other.m_tileRects);
+
+		std::swap(m_position, other.m_position);
+		std::swap(m_tileWorldSize, other.m_tileWorldSize);
+
+		std::swap(m_chunkCount, other.m_chunkCount);
+		std::swap(m_chunks, other.m_chunks);
+		std::swap(m_chunkTextures, other.m_chunkTextures);
+		std::swap(m_chunkTextureOwners, other.m_chunkTextureOwners);
+		std::swap(m_maxCachedChunkCount, other.m_maxCachedChunkCount);
+
+		std::swap(m_frameIndex, other.m_frameIndex);
+		std::swap(m_chunkRebuildCount, other.m_chunkRebuildCount);
+		std::swap(m_visibleChunkCount, other.m_visibleChunkCount);
+	}
+
+	Tilemap& Tilemap::operator =(Tilemap&& other) noexcept
+	{
+		m_renderer = std::exchange(other.m_renderer, nullptr);
+		m_textureAtlas = std::exchange(other.m_textureAtlas, nullptr);
+
+		m_size = std::exchange(other.m_size, glm::uvec2{ 0u, 0u });
+		m_tilePixelSize = std::exchange(other.m_tilePixelSize, glm::uvec2{ 0u, 0u });
+		m_tiles = std::exchange(other.m_tiles, { });
+
+		m_tileNames = std::exchange(other.m_tileNames, { });
+		m_tileRects = std::exchange(other.m_tileRects, { });
+
+		m_position = std::exchange(other.m_position, glm::vec2{ 0.0f, 0.0f });
+		m_tileWorldSize = std::exchange(other.m_tileWorldSize, 1.0f);
+
+		m_chunkCount = std::exchange(other.m_chunkCount, glm::uvec2{ 0u, 0u });
+		m_chunks = std::exchange(other.m_chunks, { });
+		m_chunkTextures = std::exchange(other.m_chunkTextures, { });
+		m_chunkTextureOwners = std::exchange(other.m_chunkTextureOwners, { });
+		m_maxCachedChunkCount = std::exchange(other.m_maxCachedChunkCount, s_DefaultMaxCachedChunkCount);
+
+		m_frameIndex = std::exchange(other.m_frameIndex, 0u);
+		m_chunkRebuildCount = std::exchange(other.m_chunkRebuildCount, 0u);
+		m_visibleChunkCount = std::exchange(other.m_visibleChunkCount, 0u);
+
+		return *this;
+	}
+
+	Tilemap::~Tilemap() noexcept
+	{
+		Destroy();
+	}
+
+	void Tilemap::Initialise(const Renderer& renderer, const TextureAtlas& textureAtlas, const std::string_view& filepath)
+	{
+		m_renderer = &renderer;
+		m_textureAtlas = &textureAtlas;
+
+		if (!LoadFromFile(filepath))
+		{
+			Log::EngineError("Failed to load tilemap at {}.", filepath);
+			Destroy();
+
+			return;
+		}
+
+		ResolveTileRects();
+		CreateChunks();
+	}
+
+	void Tilemap::Initialise(const Renderer& renderer, const TextureAtlas& textureAtlas, const std::vector<std::string>& tileNames, const glm::uvec2& size, const glm::uvec2& tilePixelSize)
+	{
+		m_renderer = &renderer;
+		m_textureAtlas = &textureAtlas;
+
+		m_size = size;
+		m_tilePixelSize = tilePixelSize;
+		m_tiles = std::vector<TileIndex>(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y), EmptyTile);
+		m_tileNames = tileNames;
+
+		ResolveTileRects();
+		CreateChunks();
+	}
+
+	void Tilemap::Destroy() noexcept
+	{
+		m_size = glm::uvec2{ 0u, 0u };
+		m_tilePixelSize = glm::uvec2{ 0u, 0u };
+		m_tiles.clear();
+
+		m_tileNames.clear();
+		m_tileRects.clear();
+
+		m_chunkCount = glm::uvec2{ 0u, 0u };
+		m_chunks.clear();
+		m_chunkTextures.clear();
+		m_chunkTextureOwners.clear();
+	}
+
+	[[nodiscard]] Status Tilemap::WriteToFile(const std::string_view& filepath) const
+	{
+		if (m_tileNames.size() > std::numeric_limits<std::uint16_t>::max()
+			|| m_tilePixelSize.x > std::numeric_limits<std::uint16_t>::max()
+			|| m_tilePixelSize.y > std::numeric_limits<std::uint16_t>::max())
+		{
+			Log::EngineError("Tilemap cannot be written to {}: it has too many tile names or its tiles are too large.", filepath);
+
+			return Status::Fail;
+		}
+
+		for (const auto& tileName : m_tileNames)
+		{
+			if (tileName.length() > std::numeric_limits<std::uint8_t>::max())
+			{
+				Log::EngineError("Tilemap cannot be written to {}: tile name \"{}\" is longer than {} bytes.", filepath, tileName, std::numeric_limits<std::uint8_t>::max());
+
+				return Status::Fail;
+			}
+		}
+
+		std::vector<std::byte> fileData(sizeof(s_FileMagic));
+		std::memcpy(fileData.data(), s_FileMagic, sizeof(s_FileMagic));
+
+		binary::WriteLittleEndian(fileData, s_FileVersion, sizeof(std::uint16_t));
+		binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(m_tileNames.size()), sizeof(std::uint16_t));
+		binary::WriteLittleEndian(fileData, m_size.x, sizeof(std::uint32_t));
+		binary::WriteLittleEndian(fileData, m_size.y, sizeof(std::uint32_t));
+		binary::WriteLittleEndian(fileData, m_tilePixelSize.x, sizeof(std::uint16_t));
+		binary::WriteLittleEndian(fileData, m_tilePixelSize.y, sizeof(std::uint16_t));
+
+		for (const auto& tileName : m_tileNames)
+		{
+			binary::WriteLittleEndian(fileData, static_cast<std::uint32_t>(tileName.length()), sizeof(std::uint8_t));
+
+			for (const char character : tileName)
+			{
+				fileData.push_back(static_cast<std::byte>(character));
+			}
+		}
+
+		fileData.reserve(fileData.size() + m_tiles.size() * sizeof(TileIndex));
+
+		for (const TileIndex tile : m_tiles)
+		{
+			binary::WriteLittleEndian(fileData, tile, sizeof(TileIndex));
+		}
+
+		return vfs::WriteToFile(filepath, fileData);
+	}
+
+	void Tilemap::Render(const Camera& camera) const
+	{
+		m_visibleChunkCount = 0u;
+
+		if (!IsValid())
+		{
+			return;
+		}
+
+		++m_frameIndex;
+
+		const float pixelsPerWorldUnit = camera.GetZoomedPixelsPerUnit();
+
+		if (pixelsPerWorldUnit <= 0.0f || m_tileWorldSize <= 0.0f)
+		{
+			return;
+		}
+
+		const float angle = glm::radians(camera.GetRotation());
+		const float sine = std::abs(std::sin(angle));
+		const float cosine = std::abs(std::cos(angle));
+
+		const glm::vec2 screenHalfExtent = static_cast<glm::vec2>(m_renderer->GetLogicalSize()) / 2.0f / pixelsPerWorldUnit;
+		const glm::vec2 viewHalfExtent{
+			cosine * screenHalfExtent.x + sine * screenHalfExtent.y,
+			sine * screenHalfExtent.x + cosine * screenHalfExtent.y,
+		};
+
+		const glm::vec2 viewCentre = camera.ScreenSpaceToWorldSpace(camera.GetScreenCentre());
+
+		const float firstColumn = std::floor((viewCentre.x - viewHalfExtent.x - m_position.x) / m_tileWorldSize);
+		const float lastColumn = std::floor((viewCentre.x + viewHalfExtent.x - m_position.x) / m_tileWorldSize);
+		const float firstRow = std::floor((m_position.y - viewCentre.y - viewHalfExtent.y) / m_tileWorldSize);
+		const float lastRow = std::floor((m_position.y - viewCentre.y + viewHalfExtent.y) / m_tileWorldSize);
+
+		if (lastColumn < 0.0f || lastRow < 0.0f || firstColumn >= static_cast<float>(m_size.x) || firstRow >= static_cast<float>(m_size.y))
+		{
+			return;
+		}
+
+		const glm::uvec2 firstTile{
+			static_cast<unsigned int>(std::max(firstColumn, 0.0f)),
+			static_cast<unsigned int>(std::max(firstRow, 0.0f)),
+		};
+
+		const glm::uvec2 lastTile{
+			std::min(static_cast<unsigned int>(lastColumn), m_size.x - 1u),
+			std::min(static_cast<unsigned int>(lastRow), m_size.y - 1u),
+		};
+
+		const glm::vec2 mapTopLeft = camera.WorldSpaceToScreenSpace(m_position);
+		const TileAxes tileAxes{
+			.column = camera.WorldSpaceToScreenSpace(m_position + glm::vec2{ m_tileWorldSize, 0.0f }) - mapTopLeft,
+			.row = camera.WorldSpaceToScreenSpace(m_position - glm::vec2{ 0.0f, m_tileWorldSize }) - mapTopLeft,
+			.angle = camera.GetRotation(),
+		};
+
+		const float tileScreenSize = m_tileWorldSize * pixelsPerWorldUnit;
+
+		if (!m_renderer->CanRenderToTexture())
+		{
+			DrawTiles(firstTile, lastTile, mapTopLeft, tileAxes, glm::vec2{ tileScreenSize, tileScreenSize });
+
+			return;
+		}
+
+		const glm::uvec2 firstChunk{ firstTile.x / ChunkSize, firstTile.y / ChunkSize };
+		const glm::uvec2 lastChunk{ lastTile.x / ChunkSize, lastTile.y / ChunkSize };
+
+		for (unsigned int chunkY = firstChunk.y; chunkY <= lastChunk.y; ++chunkY)
+		{
+			for (unsigned int chunkX = firstChunk.x; chunkX <= lastChunk.x; ++chunkX)
+			{
+				const std::size_t chunkIndex = static_cast<std::size_t>(chunkY) * m_chunkCount.x + chunkX;
+				Chunk& chunk = m_chunks[chunkIndex];
+
+				if (chunk.textureSlot == s_NoTextureSlot)
+				{
+					chunk.textureSlot = AcquireChunkTexture(chunkIndex);
+					chunk.isDirty = true;
+				}
+
+				chunk.lastDrawnFrame = m_frameIndex;
+
+				if (chunk.textureSlot != s_NoTextureSlot && chunk.isDirty)
+				{
+					RebuildChunk(chunkIndex);
+				}
+			}
+		}
+
+		const float chunkScreenSize = tileScreenSize * static_cast<float>(ChunkSize);
+
+		for (unsigned int chunkY = firstChunk.y; chunkY <= lastChunk.y; ++chunkY)
+		{
+			for (unsigned int chunkX = firstChunk.x; chunkX <= lastChunk.x; ++chunkX)
+			{
+				const Chunk& chunk = m_chunks[static_cast<std::size_t>(chunkY) * m_chunkCount.x + chunkX];
+
+				if (chunk.textureSlot == s_NoTextureSlot)
+				{
+					const glm::uvec2 chunkFirstTile{ chunkX * ChunkSize, chunkY * ChunkSize };
+					const glm::uvec2 chunkLastTile{
+						std::min(chunkFirstTile.x + ChunkSize, m_size.x) - 1u,
+						std::min(chunkFirstTile.y + ChunkSize, m_size.y) - 1u,
+					};
+
+					DrawTiles(chunkFirstTile, chunkLastTile, mapTopLeft, tileAxes, glm::vec2{ tileScreenSize, tileScreenSize });
+
+					continue;
+				}
+
+				const Texture& chunkTexture = m_chunkTextures[chunk.textureSlot];
+				const float chunkTileCount = static_cast<float>(ChunkSize);
+
+				m_renderer->DrawRotatedTexture(
+					chunkTexture,
+					std::nullopt,
+					mapTopLeft + tileAxes.column * (static_cast<float>(chunkX) + 0.5f) * chunkTileCount + tileAxes.row * (static_cast<float>(chunkY) + 0.5f) * chunkTileCount,
+					glm::vec2{ chunkScreenSize, chunkScreenSize } / static_cast<glm::vec2>(chunkTexture.GetSize()),
+					tileAxes.angle
+				);
+
+				++m_visibleChunkCount;
+			}
+		}
+	}
+
+	[[nodiscard]] Tilemap::TileIndex Tilemap::GetTile(const unsigned int x, const unsigned int y) const
+	{
+		if (x >= m_size.x || y >= m_size.y)
+		{
+			return EmptyTile;
+		}
+
+		return m_tiles[static_cast<std::size_t>(y) * m_size.x + x];
+	}
+
+	void Tilemap::SetTile(const unsigned int x, const unsigned int y, const TileIndex tile)
+	{
+		if (x >= m_size.x || y >= m_size.y)
+		{
+			return;
+		}
+
+		TileIndex& currentTile = m_tiles[static_cast<std::size_t>(y) * m_size.x + x];
+
+		if (currentTile != tile)
+		{
+			currentTile = tile;
+			m_chunks[static_cast<std::size_t>(y / ChunkSize) * m_chunkCount.x + x / ChunkSize].isDirty = true;
+		}
+	}
+
+	void Tilemap::MarkAllChunksDirty() noexcept
+	{
+		for (auto& chunk : m_chunks)
+		{
+			chunk.isDirty = true;
+		}
+	}
+
+	void Tilemap::SetMaxCachedChunkCount(const std::size_t maxCachedChunkCount)
+	{
+		m_maxCachedChunkCount = maxCachedChunkCount;
+
+		if (m_chunkTextures.size() > maxCachedChunkCount)
+		{
+			for (std::size_t textureSlot = maxCachedChunkCount; textureSlot < m_chunkTextures.size(); ++textureSlot)
+			{
+				m_chunks[m_chunkTextureOwners[textureSlot]].textureSlot = s_NoTextureSlot;
+			}
+
+			m_chunkTextures.resize(maxCachedChunkCount);
+			m_chunkTextureOwners.resize(maxCachedChunkCount);
+		}
+	}
+
+	[[nodiscard]] bool Tilemap::LoadFromFile(const std::string_view& filepath)
+	{
+		constexpr std::size_t HeaderSize = sizeof(s_FileMagic) + sizeof(std::uint16_t) * 2u + sizeof(std::uint32_t) * 2u + sizeof(std::uint16_t) * 2u;
+
+		const std::vector<std::byte> fileData = vfs::ReadFileData(filepath);
+
+		if (fileData.size() < HeaderSize || std::memcmp(fileData.data(), s_FileMagic, sizeof(s_FileMagic)) != 0)
+		{
+			return false;
+		}
+
+		std::size_t offset = sizeof(s_FileMagic);
+
+		if (binary::ReadLittleEndian(fileData, offset, sizeof(std::uint16_t)) != s_FileVersion)
+		{
+			return false;
+		}
+
+		const std::uint32_t tileNameCount = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint16_t));
+		m_size.x = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint32_t));
+		m_size.y = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint32_t));
+		m_tilePixelSize.x = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint16_t));
+		m_tilePixelSize.y = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint16_t));
+
+		m_tileNames.clear();
+		m_tileNames.reserve(tileNameCount);
+
+		for (std::uint32_t i = 0u; i < tileNameCount; ++i)
+		{
+			if (offset + sizeof(std::uint8_t) > fileData.size())
+			{
+				return false;
+			}
+
+			const std::size_t nameLength = binary::ReadLittleEndian(fileData, offset, sizeof(std::uint8_t));
+
+			if (offset + nameLength > fileData.size())
+			{
+				return false;
+			}
+
+			m_tileNames.emplace_back(reinterpret_cast<const char*>(fileData.data() + offset), nameLength);
+			offset += nameLength;
+		}
+
+		const std::size_t tileCount = static_cast<std::size_t>(m_size.x) * static_cast<std::size_t>(m_size.y);
+
+		if (tileCount == 0u || fileData.size() - offset != tileCount * sizeof(TileIndex))
+		{
+			return false;
+		}
+
+		m_tiles.resize(tileCount);
+
+		for (auto& tile : m_tiles)
+		{
+			tile = static_cast<TileIndex>(binary::ReadLittleEndian(fileData, offset, sizeof(TileIndex)));
+		}
+
+		return true;
+	}
+
+	void Tilemap::ResolveTileRects()
+	{
+		m_tileRects.clear();
+		m_tileRects.reserve(m_tileNames.size());
+
+		for (const auto& tileName : m_tileNames)
+		{
+			if (const auto subtextureIndex = m_textureAtlas->GetSubtextureIndex(tileName);
+				subtextureIndex.has_value())
+			{
+				m_tileRects.push_back(m_textureAtlas->GetSubtexture(subtextureIndex.value()));
+			}
+			else
+			{
+				Log::EngineWarn("Tilemap tile \"{}\" is not in the texture atlas.", tileName);
+				m_tileRects.push_back(rect::Rect{ 0, 0, 0, 0 });
+			}
+		}
+	}
+
+	void Tilemap::CreateChunks()
+	{
+		m_chunkCount = glm::uvec2{
+			(m_size.x + ChunkSize - 1u) / ChunkSize,
+			(m_size.y + ChunkSize - 1u) / ChunkSize,
+		};
+
+		m_chunks = std::vector<Chunk>(static_cast<std::size_t>(m_chunkCount.x) * static_cast<std::size_t>(m_chunkCount.y), Chunk{
+			.textureSlot = s_NoTextureSlot,
+			.isDirty = true,
+			.lastDrawnFrame = 0u,
+		});
+
+		m_chunkTextures.clear();
+		m_chunkTextureOwners.clear();
+	}
+
+	[[nodiscard]] std::size_t Tilemap::AcquireChunkTexture(const std::size_t chunkIndex) const
+	{
+		if (m_chunkTextures.size() < m_maxCachedChunkCount)
+		{
+			Texture chunkTexture(*m_renderer, SDL_PIXELFORMAT_RGBA8888, Texture::AccessType::Target, m_tilePixelSize * ChunkSize);
+
+			if (!chunkTexture.IsValid())
+			{
+				return s_NoTextureSlot;
+			}
+
+			chunkTexture.SetBlendMode(Renderer::GetPremultipliedAlphaBlendMode());
+
+			m_chunkTextures.push_back(std::move(chunkTexture));
+			m_chunkTextureOwners.push_back(chunkIndex);
+
+			return m_chunkTextures.size() - 1u;
+		}
+
+		std::size_t leastRecentTextureSlot = s_NoTextureSlot;
+		std::uint64_t leastRecentFrame = std::numeric_limits<std::uint64_t>::max();
+
+		for (std::size_t textureSlot = 0u; textureSlot < m_chunkTextureOwners.size(); ++textureSlot)
+		{
+			const std::uint64_t lastDrawnFrame = m_chunks[m_chunkTextureOwners[textureSlot]].lastDrawnFrame;
+
+			if (lastDrawnFrame < m_frameIndex && lastDrawnFrame < leastRecentFrame)
+			{
+				leastRecentTextureSlot = textureSlot;
+				leastRecentFrame = lastDrawnFrame;
+			}
+		}
+
+		if (leastRecentTextureSlot != s_NoTextureSlot)
+		{
+			m_chunks[m_chunkTextureOwners[leastRecentTextureSlot]].textureSlot = s_NoTextureSlot;
+			m_chunkTextureOwners[leastRecentTextureSlot] = chunkIndex;
+		}
+
+		return leastRecentTextureSlot;
+	}
+
+	void Tilemap::RebuildChunk(const std::size_t chunkIndex) const
+	{
+		Chunk& chunk = m_chunks[chunkIndex];
+		Texture* const previousRenderTarget = m_renderer->GetCurrentRenderTarget();
+
+		m_renderer->SetCurrentRenderTarget(m_chunkTextures[chunk.textureSlot]);
+		m_renderer->Clear(colours::Clear);
+
+		const glm::uvec2 firstTile{
+			static_cast<unsigned int>(chunkIndex % m_chunkCount.x) * ChunkSize,
+			static_cast<unsigned int>(chunkIndex / m_chunkCount.x) * ChunkSize,
+		};
+
+		const glm::uvec2 lastTile{
+			std::min(firstTile.x + ChunkSize, m_size.x) - 1u,
+			std::min(firstTile.y + ChunkSize, m_size.y) - 1u,
+		};
+
+		const glm::vec2 tilePixelSize = static_cast<glm::vec2>(m_tilePixelSize);
+		const TileAxes tileAxes{
+			.column = glm::vec2{ tilePixelSize.x, 0.0f },
+			.row = glm::vec2{ 0.0f, tilePixelSize.y },
+			.angle = 0.0f,
+		};
+
+		DrawTiles(firstTile, lastTile, glm::vec2{ -static_cast<float>(firstTile.x) * tilePixelSize.x, -static_cast<float>(firstTile.y) * tilePixelSize.y }, tileAxes, tilePixelSize);
+
+		if (previousRenderTarget != nullptr)
+		{
+			m_renderer->SetCurrentRenderTarget(*previousRenderTarget);
+		}
+		else
+		{
+			m_renderer->ResetRenderTarget();
+		}
+
+		chunk.isDirty = false;
+		++m_chunkRebuildCount;
+	}
+
+	void Tilemap::DrawTiles(const glm::uvec2& firstTile, const glm::uvec2& lastTile, const glm::vec2& topLeft, const TileAxes& tileAxes, const glm::vec2& tileScreenSize) const
+	{
+		const Texture& atlasTexture = m_textureAtlas->GetTexture();
+
+		for (unsigned int y = firstTile.y; y <= lastTile.y; ++y)
+		{
+			for (unsigned int x = firstTile.x; x <= lastTile.x; ++x)
+			{
+				const TileIndex tile = m_tiles[static_cast<std::size_t>(y) * m_size.x + x];
+
+				if (tile == EmptyTile || tile > m_tileRects.size())
+				{
+					continue;
+				}
+
+				const rect::Rect& tileRect = m_tileRects[tile - 1u];
+
+				if (tileRect.w <= 0 || tileRect.h <= 0)
+				{
+					continue;
+				}
+
+				m_renderer->DrawRotatedTexture(
+					atlasTexture,
+					tileRect,
+					topLeft + tileAxes.column * (static_cast<float>(x) + 0.5f) + tileAxes.row * (static_cast<float>(y) + 0.5f),
+					glm::vec2{ tileScreenSize.x / static_cast<float>(tileRect.w), tileScreenSize.y / static_cast<float>(tileRect.h) },
+					tileAxes.angle
+				);
+			}
+		}
+	}
+}
\ No newline at end of file
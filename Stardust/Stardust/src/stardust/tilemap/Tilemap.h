@@ -0,0 +1,127 @@
+#pragma once
+#ifndef TILEMAP_H
+#define TILEMAP_H
+
+#include "../utility/interfaces/INoncopyable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../camera/Camera.h"
+#include "../graphics/renderer/Renderer.h"
+#include "../graphics/texture/Texture.h"
+#include "../graphics/texture/texture_atlas/TextureAtlas.h"
+#include "../rect/Rect.h"
+#include "../utility/enums/Status.h"
+
+namespace stardust
+{
+	class Tilemap
+		: private INoncopyable
+	{
+	public:
+		using TileIndex = std::uint16_t;
+
+		static constexpr TileIndex EmptyTile = 0u;
+		static constexpr unsigned int ChunkSize = 32u;
+
+	private:
+		struct Chunk
+		{
+			std::size_t textureSlot;
+			bool isDirty;
+			std::uint64_t lastDrawnFrame;
+		};
+
+		struct TileAxes
+		{
+			glm::vec2 column;
+			glm::vec2 row;
+			float angle;
+		};
+
+		static constexpr std::size_t s_NoTextureSlot = static_cast<std::size_t>(-1);
+		static constexpr std::size_t s_DefaultMaxCachedChunkCount = 64u;
+
+		static constexpr char s_FileMagic[4u]{ 'S', 'D', 'T', 'M' };
+		static constexpr std::uint16_t s_FileVersion = 1u;
+
+		const Renderer* m_renderer = nullptr;
+		const TextureAtlas* m_textureAtlas = nullptr;
+
+		glm::uvec2 m_size{ 0u, 0u };
+		glm::uvec2 m_tilePixelSize{ 0u, 0u };
+		std::vector<TileIndex> m_tiles{ };
+
+		std::vector<std::string> m_tileNames{ };
+		std::vector<rect::Rect> m_tileRects{ };
+
+		glm::vec2 m_position{ 0.0f, 0.0f };
+		float m_tileWorldSize = 1.0f;
+
+		glm::uvec2 m_chunkCount{ 0u, 0u };
+		mutable std::vector<Chunk> m_chunks{ };
+		mutable std::vector<Texture> m_chunkTextures{ };
+		mutable std::vector<std::size_t> m_chunkTextureOwners{ };
+		std::size_t m_maxCachedChunkCount = s_DefaultMaxCachedChunkCount;
+
+		mutable std::uint64_t m_frameIndex = 0u;
+		mutable unsigned int m_chunkRebuildCount = 0u;
+		mutable unsigned int m_visibleChunkCount = 0u;
+
+	public:
+		Tilemap() = default;
+		Tilemap(const Renderer& renderer, const TextureAtlas& textureAtlas, const std::string_view& filepath);
+		Tilemap(const Renderer& renderer, const TextureAtlas& textureAtlas, const std::vector<std::string>& tileNames, const glm::uvec2& size, const glm::uvec2& tilePixelSize);
+
+		Tilemap(Tilemap&& other) noexcept;
+		Tilemap& operator =(Tilemap&& other) noexcept;
+
+		~Tilemap() noexcept;
+
+		void Initialise(const Renderer& renderer, const TextureAtlas& textureAtlas, const std::string_view& filepath);
+		void Initialise(const Renderer& renderer, const TextureAtlas& textureAtlas, const std::vector<std::string>& tileNames, const glm::uvec2& size, const glm::uvec2& tilePixelSize);
+		void Destroy() noexcept;
+
+		[[nodiscard]] Status WriteToFile(const std::string_view& filepath) const;
+
+		void Render(const Camera& camera) const;
+
+		[[nodiscard]] TileIndex GetTile(const unsigned int x, const unsigned int y) const;
+		void SetTile(const unsigned int x, const unsigned int y, const TileIndex tile);
+		void MarkAllChunksDirty() noexcept;
+
+		inline bool IsValid() const noexcept { return !m_tiles.empty(); }
+
+		inline const glm::uvec2& GetSize() const noexcept { return m_size; }
+		inline const glm::uvec2& GetTilePixelSize() const noexcept { return m_tilePixelSize; }
+		inline const std::vector<std::string>& GetTileNames() const noexcept { return m_tileNames; }
+
+		inline const glm::vec2& GetPosition() const noexcept { return m_position; }
+		inline void SetPosition(const glm::vec2& position) noexcept { m_position = position; }
+		inline float GetTileWorldSize() const noexcept { return m_tileWorldSize; }
+		inline void SetTileWorldSize(const float tileWorldSize) noexcept { m_tileWorldSize = tileWorldSize; }
+
+		inline std::size_t GetMaxCachedChunkCount() const noexcept { return m_maxCachedChunkCount; }
+		void SetMaxCachedChunkCount(const std::size_t maxCachedChunkCount);
+
+		inline unsigned int GetChunkRebuildCount() const noexcept { return m_chunkRebuildCount; }
+		inline unsigned int GetVisibleChunkCount() const noexcept { return m_visibleChunkCount; }
+
+	private:
+		[[nodiscard]] bool LoadFromFile(const std::string_view& filepath);
+		void ResolveTileRects();
+		void CreateChunks();
+
+		[[nodiscard]] std::size_t AcquireChunkTexture(const std::size_t chunkIndex) const;
+		void RebuildChunk(const std::size_t chunkIndex) const;
+		void DrawTiles(const glm::uvec2& firstTile, const glm::uvec2& lastTile, const glm::vec2& topLeft, const TileAxes& tileAxes, const glm::vec2& tileScreenSize) const;
+	};
+}
+
+#endif
\ No newline at end of file
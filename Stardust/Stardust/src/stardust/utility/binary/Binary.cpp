@@ -0,0 +1,38 @@
+#include "Binary.h"
+
+#include <fstream>
+#include <system_error>
+
+namespace stardust
+{
+	namespace binary
+	{
+		[[nodiscard]] Status WriteToFile(const std::filesystem::path& filepath, const std::span<const std::byte> data)
+		{
+			return WriteToFile(filepath, std::span<const std::span<const std::byte>>(&data, 1u));
+		}
+
+		[[nodiscard]] Status WriteToFile(const std::filesystem::path& filepath, const std::span<const std::span<const std::byte>> dataChunks)
+		{
+			if (filepath.has_parent_path())
+			{
+				std::error_code errorCode;
+				std::filesystem::create_directories(filepath.parent_path(), errorCode);
+			}
+
+			std::ofstream file(filepath, std::ios_base::binary | std::ios_base::trunc);
+
+			if (!file.is_open())
+			{
+				return Status::Fail;
+			}
+
+			for (const auto& dataChunk : dataChunks)
+			{
+				file.write(reinterpret_cast<const char*>(dataChunk.data()), static_cast<std::streamsize>(dataChunk.size()));
+			}
+
+			return file.good() ? Status::Success : Status::Fail;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+#ifndef BINARY_H
+#define BINARY_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include "../enums/Status.h"
+
+namespace stardust
+{
+	namespace binary
+	{
+		template <std::unsigned_integral T = std::uint32_t>
+		[[nodiscard]] T ReadLittleEndian(const std::span<const std::byte> data, std::size_t& offset, const std::size_t byteCount)
+		{
+			T value = 0u;
+
+			for (std::size_t i = 0u; i < byteCount; ++i)
+			{
+				value |= static_cast<T>(static_cast<T>(data[offset + i]) << (i * 8u));
+			}
+
+			offset += byteCount;
+
+			return value;
+		}
+
+		template <std::unsigned_integral T>
+		void WriteLittleEndian(std::vector<std::byte>& data, const T value, const std::size_t byteCount)
+		{
+			for (std::size_t i = 0u; i < byteCount; ++i)
+			{
+				data.push_back(static_cast<std::byte>((value >> (i * 8u)) & 0xFFu));
+			}
+		}
+
+		[[nodiscard]] extern Status WriteToFile(const std::filesystem::path& filepath, const std::span<const std::byte> data);
+		[[nodiscard]] extern Status WriteToFile(const std::filesystem::path& filepath, const std::span<const std::span<const std::byte>> dataChunks);
+	}
+}
+
+#endif
\ No newline at end of file
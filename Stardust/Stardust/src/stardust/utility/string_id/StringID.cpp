@@ -0,0 +1,56 @@
+#include "StringID.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#include "../../debug/logging/Log.h"
+
+namespace stardust
+{
+#ifndef NDEBUG
+	namespace
+	{
+		std::mutex s_internTableMutex;
+		std::unordered_map<StringID::Hash, std::string> s_internTable{ };
+	}
+#endif
+
+	[[nodiscard]] StringID StringID::Intern(const std::string_view& string)
+	{
+		const StringID stringID(string);
+
+	#ifndef NDEBUG
+		const std::scoped_lock<std::mutex> lock(s_internTableMutex);
+
+		if (const auto internedString = s_internTable.find(stringID.GetHash());
+			internedString != std::cend(s_internTable))
+		{
+			if (internedString->second != string)
+			{
+				Log::EngineError("String ID collision between \"{}\" and \"{}\".", internedString->second, string);
+			}
+		}
+		else
+		{
+			s_internTable.emplace(stringID.GetHash(), std::string(string));
+		}
+	#endif
+
+		return stringID;
+	}
+
+	[[nodiscard]] std::string StringID::GetString(const StringID stringID)
+	{
+	#ifndef NDEBUG
+		const std::scoped_lock<std::mutex> lock(s_internTableMutex);
+
+		if (const auto internedString = s_internTable.find(stringID.GetHash());
+			internedString != std::cend(s_internTable))
+		{
+			return internedString->second;
+		}
+	#endif
+
+		return "#" + std::to_string(stringID.GetHash());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+#ifndef STRING_ID_H
+#define STRING_ID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace stardust
+{
+	class StringID
+	{
+	public:
+		using Hash = std::uint64_t;
+
+	private:
+		static constexpr Hash s_FNVOffsetBasis = 14'695'981'039'346'656'037ull;
+		static constexpr Hash s_FNVPrime = 1'099'511'628'211ull;
+
+		Hash m_hash = s_FNVOffsetBasis;
+
+	public:
+		[[nodiscard]] static constexpr Hash HashString(const std::string_view& string) noexcept
+		{
+			Hash hash = s_FNVOffsetBasis;
+
+			for (const char character : string)
+			{
+				hash ^= static_cast<Hash>(static_cast<unsigned char>(character));
+				hash *= s_FNVPrime;
+			}
+
+			return hash;
+		}
+
+		[[nodiscard]] static StringID Intern(const std::string_view& string);
+		[[nodiscard]] static std::string GetString(const StringID stringID);
+
+		constexpr StringID() noexcept = default;
+
+		constexpr StringID(const char* const string) noexcept
+			: m_hash(HashString(string))
+		{ }
+
+		constexpr StringID(const std::string_view& string) noexcept
+			: m_hash(HashString(string))
+		{ }
+
+		StringID(const std::string& string) noexcept
+			: m_hash(HashString(string))
+		{ }
+
+		~StringID() noexcept = default;
+
+		[[nodiscard]] constexpr bool operator ==(const StringID&) const noexcept = default;
+
+		[[nodiscard]] inline constexpr Hash GetHash() const noexcept { return m_hash; }
+	};
+
+	namespace string_id_literals
+	{
+		[[nodiscard]] consteval StringID operator ""_sid(const char* const string, const std::size_t length)
+		{
+			return StringID(std::string_view(string, length));
+		}
+	}
+}
+
+template <>
+struct std::hash<stardust::StringID>
+{
+	[[nodiscard]] inline std::size_t operator ()(const stardust::StringID stringID) const noexcept
+	{
+		return static_cast<std::size_t>(stringID.GetHash());
+	}
+};
+
+#endif
\ No newline at end of file
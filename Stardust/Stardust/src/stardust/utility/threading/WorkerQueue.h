@@ -0,0 +1,304 @@
+#pragma once
+#ifndef WORKER_QUEUE_H
+#define WORKER_QUEUE_H
+
+#include "../interfaces/INoncopyable.h"
+#include "../interfaces/INonmovable.h"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace stardust
+{
+	template <typename Result, std::size_t PriorityCount = 1u>
+	class WorkerQueue
+		: private INoncopyable, private INonmovable
+	{
+	public:
+		using JobID = std::uint64_t;
+		using Job = std::function<Result()>;
+		using CompletionCallback = std::function<void(Result&& result)>;
+
+		static constexpr JobID InvalidJobID = 0u;
+
+	private:
+		struct QueuedJob
+		{
+			JobID id;
+			Job job;
+		};
+
+		struct CompletedJob
+		{
+			JobID id;
+			Result result;
+		};
+
+		std::vector<std::thread> m_workerThreads{ };
+		bool m_isRunning = false;
+
+		std::mutex m_jobMutex;
+		std::condition_variable m_jobCondition;
+		std::array<std::deque<QueuedJob>, PriorityCount> m_jobs{ };
+
+		std::mutex m_completedJobMutex;
+		std::condition_variable m_completedJobCondition;
+		std::deque<CompletedJob> m_completedJobs{ };
+
+		std::unordered_map<JobID, CompletionCallback> m_pendingCallbacks{ };
+		JobID m_nextJobID = InvalidJobID + 1u;
+
+	public:
+		WorkerQueue() = default;
+
+		explicit WorkerQueue(const unsigned int workerCount)
+		{
+			Initialise(workerCount);
+		}
+
+		~WorkerQueue() noexcept
+		{
+			Destroy();
+		}
+
+		void Initialise(const unsigned int workerCount)
+		{
+			Destroy();
+
+			m_isRunning = true;
+
+			const unsigned int threadCount = std::max(workerCount, 1u);
+			m_workerThreads.reserve(threadCount);
+
+			for (unsigned int i = 0u; i < threadCount; ++i)
+			{
+				m_workerThreads.emplace_back(&WorkerQueue::ProcessJobs, this);
+			}
+		}
+
+		void Destroy() noexcept
+		{
+			if (m_isRunning)
+			{
+				{
+					const std::scoped_lock<std::mutex> lock(m_jobMutex);
+
+					m_isRunning = false;
+
+					for (auto& jobs : m_jobs)
+					{
+						jobs.clear();
+					}
+				}
+
+				m_jobCondition.notify_all();
+
+				for (auto& workerThread : m_workerThreads)
+				{
+					workerThread.join();
+				}
+
+				m_workerThreads.clear();
+
+				{
+					const std::scoped_lock<std::mutex> lock(m_completedJobMutex);
+					m_completedJobs.clear();
+				}
+
+				m_pendingCallbacks.clear();
+			}
+		}
+
+		JobID Submit(const Job& job, const CompletionCallback& callback, const std::size_t priority = 0u)
+		{
+			if (!m_isRunning)
+			{
+				callback(Result());
+
+				return InvalidJobID;
+			}
+
+			const JobID jobID = m_nextJobID++;
+			m_pendingCallbacks[jobID] = callback;
+
+			{
+				const std::scoped_lock<std::mutex> lock(m_jobMutex);
+
+				m_jobs[std::min(priority, PriorityCount - 1u)].push_back(QueuedJob{
+					.id = jobID,
+					.job = job,
+				});
+			}
+
+			m_jobCondition.notify_one();
+
+			return jobID;
+		}
+
+		bool Cancel(const JobID jobID)
+		{
+			const auto callbackLocation = m_pendingCallbacks.find(jobID);
+
+			if (callbackLocation == std::end(m_pendingCallbacks))
+			{
+				return false;
+			}
+
+			const CompletionCallback callback = std::move(callbackLocation->second);
+			m_pendingCallbacks.erase(callbackLocation);
+
+			{
+				const std::scoped_lock<std::mutex> lock(m_jobMutex);
+
+				for (auto& jobs : m_jobs)
+				{
+					if (const auto jobLocation = std::ranges::find(jobs, jobID, &QueuedJob::id);
+						jobLocation != std::end(jobs))
+					{
+						jobs.erase(jobLocation);
+
+						break;
+					}
+				}
+			}
+
+			callback(Result());
+
+			return true;
+		}
+
+		void ProcessCompletions()
+		{
+			std::deque<CompletedJob> completedJobs{ };
+
+			{
+				const std::scoped_lock<std::mutex> lock(m_completedJobMutex);
+				std::swap(completedJobs, m_completedJobs);
+			}
+
+			for (auto& completedJob : completedJobs)
+			{
+				CompleteJob(completedJob);
+			}
+		}
+
+		bool ProcessNextCompletion()
+		{
+			CompletedJob completedJob;
+
+			{
+				const std::scoped_lock<std::mutex> lock(m_completedJobMutex);
+
+				if (m_completedJobs.empty())
+				{
+					return false;
+				}
+
+				completedJob = std::move(m_completedJobs.front());
+				m_completedJobs.pop_front();
+			}
+
+			CompleteJob(completedJob);
+
+			return true;
+		}
+
+		void WaitForAll()
+		{
+			while (m_isRunning && !m_pendingCallbacks.empty())
+			{
+				std::deque<CompletedJob> completedJobs{ };
+
+				{
+					std::unique_lock<std::mutex> lock(m_completedJobMutex);
+					m_completedJobCondition.wait(lock, [this]() { return !m_completedJobs.empty(); });
+
+					std::swap(completedJobs, m_completedJobs);
+				}
+
+				for (auto& completedJob : completedJobs)
+				{
+					CompleteJob(completedJob);
+				}
+			}
+		}
+
+		inline bool IsValid() const noexcept { return m_isRunning; }
+		inline bool IsIdle() const noexcept { return m_pendingCallbacks.empty(); }
+		inline std::size_t GetPendingJobCount() const noexcept { return m_pendingCallbacks.size(); }
+
+	private:
+		void ProcessJobs()
+		{
+			while (true)
+			{
+				QueuedJob queuedJob;
+
+				{
+					std::unique_lock<std::mutex> lock(m_jobMutex);
+					m_jobCondition.wait(lock, [this]()
+					{
+						return !m_isRunning || std::ranges::any_of(m_jobs, [](const auto& jobs) { return !jobs.empty(); });
+					});
+
+					if (!m_isRunning)
+					{
+						return;
+					}
+
+					for (auto jobs = std::rbegin(m_jobs); jobs != std::rend(m_jobs); ++jobs)
+					{
+						if (!jobs->empty())
+						{
+							queuedJob = std::move(jobs->front());
+							jobs->pop_front();
+
+							break;
+						}
+					}
+				}
+
+				Result result = queuedJob.job();
+
+				{
+					const std::scoped_lock<std::mutex> lock(m_completedJobMutex);
+
+					m_completedJobs.push_back(CompletedJob{
+						.id = queuedJob.id,
+						.result = std::move(result),
+					});
+				}
+
+				m_completedJobCondition.notify_one();
+			}
+		}
+
+		void CompleteJob(CompletedJob& completedJob)
+		{
+			const auto callbackLocation = m_pendingCallbacks.find(completedJob.id);
+
+			if (callbackLocation == std::end(m_pendingCallbacks))
+			{
+				return;
+			}
+
+			const CompletionCallback callback = std::move(callbackLocation->second);
+			m_pendingCallbacks.erase(callbackLocation);
+
+			callback(std::move(completedJob.result));
+		}
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "AsyncReader.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "VFS.h"
+
+namespace stardust
+{
+	namespace vfs
+	{
+		[[nodiscard]] unsigned int AsyncReader::GetDefaultWorkerCount() noexcept
+		{
+			return 2u;
+		}
+
+		AsyncReader::AsyncReader(const unsigned int workerCount)
+		{
+			Initialise(workerCount);
+		}
+
+		AsyncReader::~AsyncReader() noexcept
+		{
+			Destroy();
+		}
+
+		void AsyncReader::Initialise(const unsigned int workerCount)
+		{
+			m_readQueue.Initialise(workerCount);
+		}
+
+		void AsyncReader::Destroy() noexcept
+		{
+			m_readQueue.Destroy();
+		}
+
+		AsyncReader::RequestID AsyncReader::Read(const std::string_view& filepath, const CompletionCallback& callback, const Priority priority)
+		{
+			return m_readQueue.Submit([filepath = std::string(filepath)]()
+			{
+				return ReadFileView(filepath);
+			}, callback, static_cast<std::size_t>(priority));
+		}
+
+		[[nodiscard]] AsyncReader::FutureRead AsyncReader::Read(const std::string_view& filepath, const Priority priority)
+		{
+			const std::shared_ptr<std::promise<FileView>> fileViewPromise = std::make_shared<std::promise<FileView>>();
+			std::future<FileView> fileViewFuture = fileViewPromise->get_future();
+
+			const RequestID requestID = Read(filepath, [fileViewPromise](FileView&& fileView)
+			{
+				fileViewPromise->set_value(std::move(fileView));
+			}, priority);
+
+			return FutureRead{
+				.id = requestID,
+				.fileView = std::move(fileViewFuture),
+			};
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+#ifndef ASYNC_READER_H
+#define ASYNC_READER_H
+
+#include "../utility/interfaces/INoncopyable.h"
+#include "../utility/interfaces/INonmovable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <string_view>
+
+#include "../utility/threading/WorkerQueue.h"
+#include "FileView.h"
+
+namespace stardust
+{
+	namespace vfs
+	{
+		class AsyncReader
+			: private INoncopyable, private INonmovable
+		{
+		public:
+			enum class Priority
+				: std::size_t
+			{
+				Low = 0u,
+				Normal = 1u,
+				High = 2u,
+				Critical = 3u,
+			};
+
+			using RequestID = std::uint64_t;
+			using CompletionCallback = std::function<void(FileView&& fileView)>;
+
+			static constexpr RequestID InvalidRequestID = 0u;
+
+			struct FutureRead
+			{
+				RequestID id;
+				std::future<FileView> fileView;
+			};
+
+		private:
+			static constexpr std::size_t s_PriorityCount = 4u;
+
+			WorkerQueue<FileView, s_PriorityCount> m_readQueue;
+
+		public:
+			[[nodiscard]] static unsigned int GetDefaultWorkerCount() noexcept;
+
+			AsyncReader() = default;
+			explicit AsyncReader(const unsigned int workerCount);
+			~AsyncReader() noexcept;
+
+			void Initialise(const unsigned int workerCount = GetDefaultWorkerCount());
+			void Destroy() noexcept;
+
+			RequestID Read(const std::string_view& filepath, const CompletionCallback& callback, const Priority priority = Priority::Normal);
+			// Completions are only delivered by ProcessCompletions() or WaitForAll(), so never block on the future from the thread that pumps them.
+			[[nodiscard]] FutureRead Read(const std::string_view& filepath, const Priority priority = Priority::Normal);
+
+			inline bool Cancel(const RequestID requestID) { return m_readQueue.Cancel(requestID); }
+
+			inline void ProcessCompletions() { m_readQueue.ProcessCompletions(); }
+			inline void WaitForAll() { m_readQueue.WaitForAll(); }
+
+			inline bool IsValid() const noexcept { return m_readQueue.IsValid(); }
+			inline bool IsIdle() const noexcept { return m_readQueue.IsIdle(); }
+			inline std::size_t GetPendingRequestCount() const noexcept { return m_readQueue.GetPendingJobCount(); }
+		};
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include "FileView.h"
+
+#include <cstdint>
+#include <mutex>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
+#include <physfs/physfs.h>
+
+namespace stardust
+{
+	namespace vfs
+	{
+		namespace
+		{
+			std::mutex s_bufferPoolMutex;
+			std::vector<std::vector<std::byte>> s_bufferPool{ };
+
+			[[nodiscard]] std::uint64_t GetMappingGranularity()
+			{
+			#ifdef _WIN32
+				SYSTEM_INFO systemInfo{ };
+				GetSystemInfo(&systemInfo);
+
+				return static_cast<std::uint64_t>(systemInfo.dwAllocationGranularity);
+			#else
+				return static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+			#endif
+			}
+		}
+
+		[[nodiscard]] FileView FileView::MapFile(const std::filesystem::path& filepath)
+		{
+			std::error_code errorCode;
+			const std::uintmax_t fileSize = std::filesystem::file_size(filepath, errorCode);
+
+			if (errorCode || fileSize == 0u)
+			{
+				return FileView();
+			}
+
+			return MapFileRegion(filepath, 0u, static_cast<std::size_t>(fileSize));
+		}
+
+		[[nodiscard]] FileView FileView::MapFileRegion(const std::filesystem::path& filepath, const std::uint64_t offset, const std::size_t size)
+		{
+			FileView fileView;
+
+			if (size == 0u)
+			{
+				return fileView;
+			}
+
+			const std::uint64_t mappingOffset = offset - offset % GetMappingGranularity();
+			const std::size_t mappingSize = size + static_cast<std::size_t>(offset - mappingOffset);
+
+		#ifdef _WIN32
+			const HANDLE fileHandle = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+			if (fileHandle == INVALID_HANDLE_VALUE)
+			{
+				return fileView;
+			}
+
+			const HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			CloseHandle(fileHandle);
+
+			if (mappingHandle == nullptr)
+			{
+				return fileView;
+			}
+
+			void* const mappingBase = MapViewOfFile(mappingHandle, FILE_MAP_READ, static_cast<DWORD>(mappingOffset >> 32u), static_cast<DWORD>(mappingOffset & 0xFF'FF'FF'FFu), mappingSize);
+			CloseHandle(mappingHandle);
+
+			if (mappingBase == nullptr)
+			{
+				return fileView;
+			}
+		#else
+			const int fileDescriptor = open(filepath.c_str(), O_RDONLY);
+
+			if (fileDescriptor == -1)
+			{
+				return fileView;
+			}
+
+			void* const mappingBase = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fileDescriptor, static_cast<off_t>(mappingOffset));
+			close(fileDescriptor);
+
+			if (mappingBase == MAP_FAILED)
+			{
+				return fileView;
+			}
+		#endif
+
+			fileView.m_mappingBase = mappingBase;
+			fileView.m_mappingSize = mappingSize;
+			fileView.m_data = static_cast<const std::byte*>(mappingBase) + (offset - mappingOffset);
+			fileView.m_size = size;
+			fileView.m_backing = Backing::MemoryMapped;
+
+			return fileView;
+		}
+
+		[[nodiscard]] FileView FileView::ReadFile(const std::string_view& filepath)
+		{
+			FileView fileView;
+			PHYSFS_File* file = PHYSFS_openRead(filepath.data());
+
+			if (file == nullptr)
+			{
+				return fileView;
+			}
+
+			const PHYSFS_sint64 fileSize = PHYSFS_fileLength(file);
+
+			if (fileSize <= 0)
+			{
+				PHYSFS_close(file);
+				file = nullptr;
+
+				return fileView;
+			}
+
+			std::vector<std::byte> buffer = AcquirePooledBuffer(static_cast<std::size_t>(fileSize));
+
+			if (PHYSFS_readBytes(file, buffer.data(), static_cast<PHYSFS_uint64>(fileSize)) != fileSize)
+			{
+				PHYSFS_close(file);
+				file = nullptr;
+				ReleasePooledBuffer(std::move(buffer));
+
+				return fileView;
+			}
+
+			PHYSFS_close(file);
+			file = nullptr;
+
+			fileView.m_buffer = std::move(buffer);
+			fileView.m_data = fileView.m_buffer.data();
+			fileView.m_size = fileView.m_buffer.size();
+			fileView.m_backing = Backing::PooledBuffer;
+
+			return fileView;
+		}
+
+		FileView::FileView(FileView&& other) noexcept
+			: m_data(nullptr), m_size(0u), m_backing(Backing::None), m_mappingBase(nullptr), m_mappingSize(0u), m_buffer()
+		{
+			std::swap(m_data, other.m_data);
+			std::swap(m_size, other.m_size);
+			std::swap(m_backing, other.m_backing);
+			std::swap(m_mappingBase, other.m_mappingBase);
+			std::swap(m_mappingSize, other.m_mappingSize);
+			std::swap(m_buffer, other.m_buffer);
+		}
+
+		FileView& FileView::operator =(FileView&& other) noexcept
+		{
+			Destroy();
+
+			m_data = std::exchange(other.m_data, nullptr);
+			m_size = std::exchange(other.m_size, 0u);
+			m_backing = std::exchange(other.m_backing, Backing::None);
+			m_mappingBase = std::exchange(other.m_mappingBase, nullptr);
+			m_mappingSize = std::exchange(other.m_mappingSize, 0u);
+			m_buffer = std::exchange(other.m_buffer, { });
+
+			return *this;
+		}
+
+		FileView::~FileView() noexcept
+		{
+			Destroy();
+		}
+
+		void FileView::Destroy() noexcept
+		{
+			switch (m_backing)
+			{
+			case Backing::MemoryMapped:
+			#ifdef _WIN32
+				UnmapViewOfFile(m_mappingBase);
+			#else
+				munmap(m_mappingBase, m_mappingSize);
+			#endif
+
+				break;
+
+			case Backing::PooledBuffer:
+				ReleasePooledBuffer(std::move(m_buffer));
+				m_buffer = { };
+
+				break;
+
+			case Backing::None:
+			default:
+				break;
+			}
+
+			m_data = nullptr;
+			m_size = 0u;
+			m_backing = Backing::None;
+			m_mappingBase = nullptr;
+			m_mappingSize = 0u;
+		}
+
+		[[nodiscard]] std::vector<std::byte> FileView::AcquirePooledBuffer(const std::size_t size)
+		{
+			std::vector<std::byte> buffer{ };
+
+			{
+				const std::scoped_lock<std::mutex> lock(s_bufferPoolMutex);
+
+				if (!s_bufferPool.empty())
+				{
+					buffer = std::move(s_bufferPool.back());
+					s_bufferPool.pop_back();
+				}
+			}
+
+			buffer.resize(size);
+
+			return buffer;
+		}
+
+		void FileView::ReleasePooledBuffer(std::vector<std::byte>&& buffer) noexcept
+		{
+			if (buffer.capacity() == 0u || buffer.capacity() > s_MaxPooledBufferSize)
+			{
+				return;
+			}
+
+			buffer.clear();
+
+			const std::scoped_lock<std::mutex> lock(s_bufferPoolMutex);
+
+			if (s_bufferPool.size() < s_MaxPooledBufferCount)
+			{
+				s_bufferPool.push_back(std::move(buffer));
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef FILE_VIEW_H
+#define FILE_VIEW_H
+
+#include "../utility/interfaces/INoncopyable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace stardust
+{
+	namespace vfs
+	{
+		class FileView
+			: private INoncopyable
+		{
+		public:
+			enum class Backing
+			{
+				None,
+				MemoryMapped,
+				PooledBuffer,
+			};
+
+		private:
+			static constexpr std::size_t s_MaxPooledBufferCount = 8u;
+			static constexpr std::size_t s_MaxPooledBufferSize = 16'000'000u;
+
+			const std::byte* m_data = nullptr;
+			std::size_t m_size = 0u;
+			Backing m_backing = Backing::None;
+
+			void* m_mappingBase = nullptr;
+			std::size_t m_mappingSize = 0u;
+
+			std::vector<std::byte> m_buffer{ };
+
+		public:
+			[[nodiscard]] static FileView MapFile(const std::filesystem::path& filepath);
+			[[nodiscard]] static FileView MapFileRegion(const std::filesystem::path& filepath, const std::uint64_t offset, const std::size_t size);
+			[[nodiscard]] static FileView ReadFile(const std::string_view& filepath);
+
+			FileView() = default;
+
+			FileView(FileView&& other) noexcept;
+			FileView& operator =(FileView&& other) noexcept;
+
+			~FileView() noexcept;
+
+			void Destroy() noexcept;
+
+			inline bool IsValid() const noexcept { return m_backing != Backing::None; }
+			inline bool IsEmpty() const noexcept { return m_size == 0u; }
+			inline bool IsMemoryMapped() const noexcept { return m_backing == Backing::MemoryMapped; }
+			inline Backing GetBacking() const noexcept { return m_backing; }
+
+			inline const std::byte* GetData() const noexcept { return m_data; }
+			inline std::size_t GetSize() const noexcept { return m_size; }
+			inline std::span<const std::byte> GetBytes() const noexcept { return std::span<const std::byte>(m_data, m_size); }
+
+			inline const std::byte* begin() const noexcept { return m_data; }
+			inline const std::byte* end() const noexcept { return m_data + m_size; }
+
+		private:
+			[[nodiscard]] static std::vector<std::byte> AcquirePooledBuffer(const std::size_t size);
+			static void ReleasePooledBuffer(std::vector<std::byte>&& buffer) noexcept;
+		};
+	}
+}
+
+#endif
\ No newline at end of file
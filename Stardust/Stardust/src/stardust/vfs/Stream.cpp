@@ -0,0 +1,322 @@
+#include "Stream.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace stardust
+{
+	namespace vfs
+	{
+		[[nodiscard]] SDL_RWops* Stream::OpenRWops(const std::string_view& filepath, const std::size_t bufferSize)
+		{
+			Stream* stream = new Stream(filepath, bufferSize);
+
+			if (!stream->IsValid())
+			{
+				delete stream;
+				stream = nullptr;
+
+				return nullptr;
+			}
+
+			SDL_RWops* const rwops = stream->CreateRWops(true);
+
+			if (rwops == nullptr)
+			{
+				delete stream;
+				stream = nullptr;
+			}
+
+			return rwops;
+		}
+
+		Stream::Stream(const std::string_view& filepath, const std::size_t bufferSize)
+		{
+			Initialise(filepath, bufferSize);
+		}
+
+		Stream::Stream(Stream&& other) noexcept
+			: m_handle(nullptr), m_length(0u), m_buffer(), m_bufferPosition(0u), m_bufferReadOffset(0u), m_bufferFillSize(0u)
+		{
+			std::swap(m_handle, other.m_handle);
+			std::swap(m_length, other.m_length);
+			std::swap(m_buffer, other.m_buffer);
+			std::swap(m_bufferPosition, other.m_bufferPosition);
+			std::swap(m_bufferReadOffset, other.m_bufferReadOffset);
+			std::swap(m_bufferFillSize, other.m_bufferFillSize);
+		}
+
+		Stream& Stream::operator =(Stream&& other) noexcept
+		{
+			Destroy();
+
+			m_handle = std::exchange(other.m_handle, nullptr);
+			m_length = std::exchange(other.m_length, 0u);
+			m_buffer = std::exchange(other.m_buffer, { });
+			m_bufferPosition = std::exchange(other.m_bufferPosition, 0u);
+			m_bufferReadOffset = std::exchange(other.m_bufferReadOffset, 0u);
+			m_bufferFillSize = std::exchange(other.m_bufferFillSize, 0u);
+
+			return *this;
+		}
+
+		Stream::~Stream() noexcept
+		{
+			Destroy();
+		}
+
+		void Stream::Initialise(const std::string_view& filepath, const std::size_t bufferSize)
+		{
+			m_handle = PHYSFS_openRead(filepath.data());
+
+			if (m_handle == nullptr)
+			{
+				return;
+			}
+
+			const PHYSFS_sint64 fileLength = PHYSFS_fileLength(m_handle);
+
+			if (fileLength < 0)
+			{
+				PHYSFS_close(m_handle);
+				m_handle = nullptr;
+
+				return;
+			}
+
+			m_length = static_cast<std::uint64_t>(fileLength);
+			m_buffer.resize(std::max(bufferSize, std::size_t{ 1u }));
+		}
+
+		void Stream::Destroy() noexcept
+		{
+			if (m_handle != nullptr)
+			{
+				PHYSFS_close(m_handle);
+				m_handle = nullptr;
+
+				m_length = 0u;
+				m_buffer.clear();
+				m_buffer.shrink_to_fit();
+				m_bufferPosition = 0u;
+				m_bufferReadOffset = 0u;
+				m_bufferFillSize = 0u;
+			}
+		}
+
+		[[nodiscard]] std::size_t Stream::Read(void* const out_data, const std::size_t byteCount)
+		{
+			if (m_handle == nullptr)
+			{
+				return 0u;
+			}
+
+			std::byte* destination = static_cast<std::byte*>(out_data);
+			std::size_t bytesRead = 0u;
+
+			while (bytesRead < byteCount)
+			{
+				if (m_bufferReadOffset < m_bufferFillSize)
+				{
+					const std::size_t bufferedByteCount = std::min(byteCount - bytesRead, m_bufferFillSize - m_bufferReadOffset);
+					std::memcpy(destination + bytesRead, m_buffer.data() + m_bufferReadOffset, bufferedByteCount);
+
+					m_bufferReadOffset += bufferedByteCount;
+					bytesRead += bufferedByteCount;
+
+					continue;
+				}
+
+				const std::size_t remainingByteCount = byteCount - bytesRead;
+
+				if (remainingByteCount >= m_buffer.size())
+				{
+					const PHYSFS_sint64 directBytesRead = PHYSFS_readBytes(m_handle, destination + bytesRead, static_cast<PHYSFS_uint64>(remainingByteCount));
+
+					if (directBytesRead <= 0)
+					{
+						break;
+					}
+
+					m_bufferPosition = Tell() + static_cast<std::uint64_t>(directBytesRead);
+					m_bufferReadOffset = 0u;
+					m_bufferFillSize = 0u;
+					bytesRead += static_cast<std::size_t>(directBytesRead);
+
+					continue;
+				}
+
+				if (!FillBuffer())
+				{
+					break;
+				}
+			}
+
+			return bytesRead;
+		}
+
+		[[nodiscard]] Status Stream::Seek(const std::int64_t offset, const SeekOrigin origin)
+		{
+			if (m_handle == nullptr)
+			{
+				return Status::Fail;
+			}
+
+			std::int64_t targetPosition = offset;
+
+			switch (origin)
+			{
+			case SeekOrigin::Current:
+				targetPosition += static_cast<std::int64_t>(Tell());
+
+				break;
+
+			case SeekOrigin::End:
+				targetPosition += static_cast<std::int64_t>(m_length);
+
+				break;
+
+			case SeekOrigin::Begin:
+			default:
+				break;
+			}
+
+			if (targetPosition < 0 || static_cast<std::uint64_t>(targetPosition) > m_length)
+			{
+				return Status::Fail;
+			}
+
+			const std::uint64_t newPosition = static_cast<std::uint64_t>(targetPosition);
+
+			if (newPosition >= m_bufferPosition && newPosition <= m_bufferPosition + m_bufferFillSize)
+			{
+				m_bufferReadOffset = static_cast<std::size_t>(newPosition - m_bufferPosition);
+
+				return Status::Success;
+			}
+
+			if (PHYSFS_seek(m_handle, static_cast<PHYSFS_uint64>(newPosition)) == 0)
+			{
+				return Status::Fail;
+			}
+
+			m_bufferPosition = newPosition;
+			m_bufferReadOffset = 0u;
+			m_bufferFillSize = 0u;
+
+			return Status::Success;
+		}
+
+		[[nodiscard]] SDL_RWops* Stream::CreateRWops()
+		{
+			return CreateRWops(false);
+		}
+
+		[[nodiscard]] SDL_RWops* Stream::CreateRWops(const bool ownsStream)
+		{
+			if (m_handle == nullptr)
+			{
+				return nullptr;
+			}
+
+			SDL_RWops* const rwops = SDL_AllocRW();
+
+			if (rwops == nullptr)
+			{
+				return nullptr;
+			}
+
+			rwops->size = GetRWopsSize;
+			rwops->seek = SeekRWops;
+			rwops->read = ReadRWops;
+			rwops->write = WriteRWops;
+			rwops->close = CloseRWops;
+			rwops->type = SDL_RWOPS_UNKNOWN;
+			rwops->hidden.unknown.data1 = this;
+			rwops->hidden.unknown.data2 = ownsStream ? this : nullptr;
+
+			return rwops;
+		}
+
+		[[nodiscard]] bool Stream::FillBuffer()
+		{
+			const std::uint64_t fillPosition = Tell();
+			const PHYSFS_sint64 bytesRead = PHYSFS_readBytes(m_handle, m_buffer.data(), static_cast<PHYSFS_uint64>(m_buffer.size()));
+
+			if (bytesRead <= 0)
+			{
+				return false;
+			}
+
+			m_bufferPosition = fillPosition;
+			m_bufferReadOffset = 0u;
+			m_bufferFillSize = static_cast<std::size_t>(bytesRead);
+
+			return true;
+		}
+
+		[[nodiscard]] Sint64 Stream::GetRWopsSize(SDL_RWops* const rwops)
+		{
+			return static_cast<Sint64>(static_cast<const Stream*>(rwops->hidden.unknown.data1)->GetLength());
+		}
+
+		[[nodiscard]] Sint64 Stream::SeekRWops(SDL_RWops* const rwops, const Sint64 offset, const int whence)
+		{
+			Stream* const stream = static_cast<Stream*>(rwops->hidden.unknown.data1);
+			SeekOrigin origin = SeekOrigin::Begin;
+
+			switch (whence)
+			{
+			case RW_SEEK_CUR:
+				origin = SeekOrigin::Current;
+
+				break;
+
+			case RW_SEEK_END:
+				origin = SeekOrigin::End;
+
+				break;
+
+			case RW_SEEK_SET:
+			default:
+				break;
+			}
+
+			if (stream->Seek(static_cast<std::int64_t>(offset), origin) == Status::Fail)
+			{
+				return -1;
+			}
+
+			return static_cast<Sint64>(stream->Tell());
+		}
+
+		[[nodiscard]] std::size_t Stream::ReadRWops(SDL_RWops* const rwops, void* const out_data, const std::size_t size, const std::size_t maxCount)
+		{
+			if (size == 0u)
+			{
+				return 0u;
+			}
+
+			Stream* const stream = static_cast<Stream*>(rwops->hidden.unknown.data1);
+
+			return stream->Read(out_data, size * maxCount) / size;
+		}
+
+		[[nodiscard]] std::size_t Stream::WriteRWops(SDL_RWops* const, const void* const, const std::size_t, const std::size_t)
+		{
+			return 0u;
+		}
+
+		int Stream::CloseRWops(SDL_RWops* const rwops)
+		{
+			if (rwops != nullptr)
+			{
+				delete static_cast<Stream*>(rwops->hidden.unknown.data2);
+				SDL_FreeRW(rwops);
+			}
+
+			return 0;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+#ifndef STREAM_H
+#define STREAM_H
+
+#include "../utility/interfaces/INoncopyable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <physfs/physfs.h>
+#include <SDL2/SDL.h>
+
+#include "../utility/enums/Status.h"
+
+namespace stardust
+{
+	namespace vfs
+	{
+		class Stream
+			: private INoncopyable
+		{
+		public:
+			enum class SeekOrigin
+			{
+				Begin,
+				Current,
+				End,
+			};
+
+			static constexpr std::size_t DefaultBufferSize = 64'000u;
+
+		private:
+			PHYSFS_File* m_handle = nullptr;
+			std::uint64_t m_length = 0u;
+
+			std::vector<std::byte> m_buffer{ };
+			std::uint64_t m_bufferPosition = 0u;
+			std::size_t m_bufferReadOffset = 0u;
+			std::size_t m_bufferFillSize = 0u;
+
+		public:
+			[[nodiscard]] static SDL_RWops* OpenRWops(const std::string_view& filepath, const std::size_t bufferSize = DefaultBufferSize);
+
+			Stream() = default;
+			explicit Stream(const std::string_view& filepath, const std::size_t bufferSize = DefaultBufferSize);
+
+			Stream(Stream&& other) noexcept;
+			Stream& operator =(Stream&& other) noexcept;
+
+			~Stream() noexcept;
+
+			void Initialise(const std::string_view& filepath, const std::size_t bufferSize = DefaultBufferSize);
+			void Destroy() noexcept;
+
+			[[nodiscard]] std::size_t Read(void* const out_data, const std::size_t byteCount);
+			[[nodiscard]] Status Seek(const std::int64_t offset, const SeekOrigin origin = SeekOrigin::Begin);
+			inline std::uint64_t Tell() const noexcept { return m_bufferPosition + m_bufferReadOffset; }
+
+			[[nodiscard]] SDL_RWops* CreateRWops();
+
+			inline bool IsValid() const noexcept { return m_handle != nullptr; }
+			inline bool IsEndOfFile() const noexcept { return Tell() >= m_length; }
+
+			inline std::uint64_t GetLength() const noexcept { return m_length; }
+			inline std::size_t GetBufferSize() const noexcept { return m_buffer.size(); }
+
+		private:
+			[[nodiscard]] SDL_RWops* CreateRWops(const bool ownsStream);
+			[[nodiscard]] bool FillBuffer();
+
+			[[nodiscard]] static Sint64 GetRWopsSize(SDL_RWops* const rwops);
+			[[nodiscard]] static Sint64 SeekRWops(SDL_RWops* const rwops, const Sint64 offset, const int whence);
+			[[nodiscard]] static std::size_t ReadRWops(SDL_RWops* const rwops, void* const out_data, const std::size_t size, const std::size_t maxCount);
+			[[nodiscard]] static std::size_t WriteRWops(SDL_RWops* const rwops, const void* const data, const std::size_t size, const std::size_t count);
+			static int CloseRWops(SDL_RWops* const rwops);
+		};
+	}
+}
+
+#endif
\ No newline at end of file
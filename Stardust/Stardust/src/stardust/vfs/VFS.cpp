@@ -1,33 +1,239 @@
 #include "VFS.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
 
 #include <physfs/physfs.h>
 
+#include "pak/Pak.h"
+
 namespace stardust
 {
 	namespace vfs
 	{
+		namespace
+		{
+			struct IndexEntry
+			{
+				std::uint64_t size;
+				bool isDirectory;
+				std::string realDirectory;
+
+				std::vector<std::string> childNames;
+			};
+
+			std::shared_mutex s_indexMutex;
+			std::unordered_map<std::string, IndexEntry> s_index{ };
+
+			[[nodiscard]] std::string NormaliseIndexPath(const std::string_view& filepath)
+			{
+				std::string normalisedPath;
+				normalisedPath.reserve(filepath.length());
+
+				for (const char character : filepath)
+				{
+					if (character == '/' && (normalisedPath.empty() || normalisedPath.back() == '/'))
+					{
+						continue;
+					}
+
+					normalisedPath.push_back(character);
+				}
+
+				if (!normalisedPath.empty() && normalisedPath.back() == '/')
+				{
+					normalisedPath.pop_back();
+				}
+
+				return normalisedPath;
+			}
+
+			[[nodiscard]] std::string JoinIndexPath(const std::string& directory, const std::string& name)
+			{
+				return directory.empty() ? name : directory + "/" + name;
+			}
+
+			[[nodiscard]] std::string GetIndexParentPath(const std::string& filepath)
+			{
+				const std::size_t separatorPosition = filepath.rfind('/');
+
+				return separatorPosition == std::string::npos ? std::string() : filepath.substr(0u, separatorPosition);
+			}
+
+			[[nodiscard]] bool StatIndexEntry(const std::string& filepath, IndexEntry& out_entry)
+			{
+				PHYSFS_Stat fileStat{ };
+
+				if (PHYSFS_stat(filepath.c_str(), &fileStat) == 0)
+				{
+					return false;
+				}
+
+				const char* const realDirectory = PHYSFS_getRealDir(filepath.c_str());
+
+				out_entry.isDirectory = fileStat.filetype == PHYSFS_FILETYPE_DIRECTORY;
+				out_entry.size = out_entry.isDirectory || fileStat.filesize < 0 ? 0u : static_cast<std::uint64_t>(fileStat.filesize);
+				out_entry.realDirectory = realDirectory != nullptr ? realDirectory : "";
+
+				return true;
+			}
+
+			void IndexDirectory(const std::string& directory)
+			{
+				char** enumeratedFiles = PHYSFS_enumerateFiles(directory.c_str());
+
+				if (enumeratedFiles == nullptr)
+				{
+					return;
+				}
+
+				std::vector<std::string> childNames{ };
+
+				for (const char* const* filename = enumeratedFiles; *filename != nullptr; ++filename)
+				{
+					childNames.emplace_back(*filename);
+				}
+
+				PHYSFS_freeList(enumeratedFiles);
+				enumeratedFiles = nullptr;
+
+				std::ranges::sort(childNames);
+				std::vector<std::string> indexedChildNames{ };
+				indexedChildNames.reserve(childNames.size());
+
+				for (std::string& childName : childNames)
+				{
+					const std::string childPath = JoinIndexPath(directory, childName);
+					IndexEntry childEntry{ };
+
+					if (!StatIndexEntry(childPath, childEntry))
+					{
+						continue;
+					}
+
+					const bool isChildDirectory = childEntry.isDirectory;
+					s_index[childPath] = std::move(childEntry);
+					indexedChildNames.push_back(std::move(childName));
+
+					if (isChildDirectory)
+					{
+						IndexDirectory(childPath);
+					}
+				}
+
+				s_index[directory].childNames = std::move(indexedChildNames);
+			}
+
+			void RebuildIndex()
+			{
+				const std::unique_lock<std::shared_mutex> lock(s_indexMutex);
+
+				s_index.clear();
+				s_index[""] = IndexEntry{
+					.size = 0u,
+					.isDirectory = true,
+					.realDirectory = "",
+					.childNames = { },
+				};
+
+				IndexDirectory("");
+			}
+
+			void UpdateIndexEntry(const std::string& filepath)
+			{
+				IndexEntry updatedEntry{ };
+
+				if (filepath.empty() || !StatIndexEntry(filepath, updatedEntry))
+				{
+					return;
+				}
+
+				const std::string parentPath = GetIndexParentPath(filepath);
+
+				if (!s_index.contains(parentPath))
+				{
+					UpdateIndexEntry(parentPath);
+				}
+
+				if (const auto entryLocation = s_index.find(filepath);
+					entryLocation != std::end(s_index))
+				{
+					updatedEntry.childNames = std::move(entryLocation->second.childNames);
+				}
+
+				s_index[filepath] = std::move(updatedEntry);
+
+				std::vector<std::string>& siblingNames = s_index[parentPath].childNames;
+				const std::string filename = filepath.substr(parentPath.empty() ? 0u : parentPath.length() + 1u);
+
+				if (const auto siblingLocation = std::ranges::lower_bound(siblingNames, filename);
+					siblingLocation == std::end(siblingNames) || *siblingLocation != filename)
+				{
+					siblingNames.insert(siblingLocation, filename);
+				}
+			}
+
+			void UpdateIndexEntryForWrite(const std::string_view& filepath)
+			{
+				const std::unique_lock<std::shared_mutex> lock(s_indexMutex);
+
+				UpdateIndexEntry(NormaliseIndexPath(filepath));
+			}
+
+			[[nodiscard]] const IndexEntry* FindIndexEntry(const std::string_view& filepath)
+			{
+				const auto entryLocation = s_index.find(NormaliseIndexPath(filepath));
+
+				return entryLocation != std::cend(s_index) ? &entryLocation->second : nullptr;
+			}
+		}
+
 		[[nodiscard]] bool Initialise(const char* argv0)
 		{
-			return PHYSFS_init(argv0) != 0;
+			return PHYSFS_init(argv0) != 0 && pak::RegisterArchiver();
 		}
 
 		void Quit()
 		{
+			{
+				const std::unique_lock<std::shared_mutex> lock(s_indexMutex);
+				s_index.clear();
+			}
+
 			PHYSFS_deinit();
 		}
 
 		void AddToSearchPath(const std::string_view& directory)
 		{
-			PHYSFS_mount(directory.data(), nullptr, 1);
+			if (PHYSFS_mount(directory.data(), nullptr, 1) != 0)
+			{
+				RebuildIndex();
+			}
 		}
 
 		void AddToSearchPath(const std::initializer_list<std::string_view>& directories)
 		{
+			bool didMountDirectory = false;
+
 			for (const auto& directory : directories)
 			{
-				AddToSearchPath(directory);
+				if (PHYSFS_mount(directory.data(), nullptr, 1) != 0)
+				{
+					didMountDirectory = true;
+				}
+			}
+
+			if (didMountDirectory)
+			{
+				RebuildIndex();
 			}
 		}
 
@@ -44,51 +250,76 @@ namespace stardust
 		[[nodiscard]] std::vector<std::string> GetAllFilesInDirectory(const std::string_view& directory)
 		{
 			std::vector<std::string> files{ };
-			char** enumeratedFiles = PHYSFS_enumerateFiles(directory.data());
+			const std::shared_lock<std::shared_mutex> lock(s_indexMutex);
 
-			for (const char* const* filename = enumeratedFiles; *filename != nullptr; ++filename)
+			if (const IndexEntry* const directoryEntry = FindIndexEntry(directory);
+				directoryEntry != nullptr && directoryEntry->isDirectory)
 			{
-				const std::string fullFilepath = std::string(directory) + "/" + *filename;
+				const std::string indexDirectory = NormaliseIndexPath(directory);
 
-				if (!IsDirectory(fullFilepath))
+				for (const auto& filename : directoryEntry->childNames)
 				{
-					files.push_back(fullFilepath);
+					if (!s_index.at(JoinIndexPath(indexDirectory, filename)).isDirectory)
+					{
+						files.push_back(std::string(directory) + "/" + filename);
+					}
 				}
 			}
 
-			PHYSFS_freeList(enumeratedFiles);
-			enumeratedFiles = nullptr;
-
 			return files;
 		}
 
 		[[nodiscard]] std::vector<std::string> GetAllFileNamesInDirectory(const std::string_view& directory)
-		{		
+		{
 			std::vector<std::string> files{ };
-			char** enumeratedFiles = PHYSFS_enumerateFiles(directory.data());
-			
-			for (const char* const* filename = enumeratedFiles; *filename != nullptr; ++filename)
+			const std::shared_lock<std::shared_mutex> lock(s_indexMutex);
+
+			if (const IndexEntry* const directoryEntry = FindIndexEntry(directory);
+				directoryEntry != nullptr && directoryEntry->isDirectory)
 			{
-				if (!IsDirectory(std::string(directory) + "/" + *filename))
+				const std::string indexDirectory = NormaliseIndexPath(directory);
+
+				for (const auto& filename : directoryEntry->childNames)
 				{
-					files.push_back(std::string(*filename));
+					if (!s_index.at(JoinIndexPath(indexDirectory, filename)).isDirectory)
+					{
+						files.push_back(filename);
+					}
 				}
 			}
 
-			PHYSFS_freeList(enumeratedFiles);
-			enumeratedFiles = nullptr;
-
 			return files;
 		}
 
 		[[nodiscard]] bool DoesFileExist(const std::string_view& filepath)
 		{
-			return PHYSFS_exists(filepath.data()) != 0;
+			const std::shared_lock<std::shared_mutex> lock(s_indexMutex);
+
+			return FindIndexEntry(filepath) != nullptr;
 		}
 
 		[[nodiscard]] bool IsDirectory(const std::string_view& filepath)
 		{
-			return PHYSFS_isDirectory(filepath.data()) != 0;
+			const std::shared_lock<std::shared_mutex> lock(s_indexMutex);
+			const IndexEntry* const entry = FindIndexEntry(filepath);
+
+			return entry != nullptr && entry->isDirectory;
+		}
+
+		[[nodiscard]] std::uint64_t GetFileSize(const std::string_view& filepath)
+		{
+			const std::shared_lock<std::shared_mutex> lock(s_indexMutex);
+			const IndexEntry* const entry = FindIndexEntry(filepath);
+
+			return entry != nullptr ? entry->size : 0u;
+		}
+
+		[[nodiscard]] std::string GetRealDirectory(const std::string_view& filepath)
+		{
+			const std::shared_lock<std::shared_mutex> lock(s_indexMutex);
+			const IndexEntry* const entry = FindIndexEntry(filepath);
+
+			return entry != nullptr ? entry->realDirectory : "";
 		}
 
 		[[nodiscard]] std::string GetParentFilepath(const std::string_view& filepath)
@@ -137,6 +368,44 @@ namespace stardust
 			return fileData;
 		}
 
+		[[nodiscard]] FileView ReadFileView(const std::string_view& filepath)
+		{
+			if (FileView mappedFile = MapFileView(filepath);
+				mappedFile.IsValid())
+			{
+				return mappedFile;
+			}
+
+			return FileView::ReadFile(filepath);
+		}
+
+		[[nodiscard]] FileView MapFileView(const std::string_view& filepath)
+		{
+			if (const std::string realDirectory = GetRealDirectory(filepath);
+				!realDirectory.empty())
+			{
+				std::error_code errorCode;
+
+				if (std::filesystem::is_directory(realDirectory, errorCode))
+				{
+					return FileView::MapFile(std::filesystem::path(realDirectory) / filepath);
+				}
+
+				if (const std::optional<pak::StoredEntryLocation> storedEntry = pak::FindStoredEntry(realDirectory, NormaliseIndexPath(filepath));
+					storedEntry.has_value())
+				{
+					return FileView::MapFileRegion(realDirectory, storedEntry->offset, storedEntry->size);
+				}
+			}
+
+			return FileView();
+		}
+
+		[[nodiscard]] Stream OpenStream(const std::string_view& filepath, const std::size_t bufferSize)
+		{
+			return Stream(filepath, bufferSize);
+		}
+
 		[[nodiscard]] Status WriteToFile(const std::string_view& filepath, const std::vector<std::byte>& data)
 		{
 			PHYSFS_File* file = PHYSFS_openWrite(filepath.data());
@@ -156,6 +425,7 @@ namespace stardust
 
 			PHYSFS_close(file);
 			file = nullptr;
+			UpdateIndexEntryForWrite(filepath);
 
 			return Status::Success;
 		}
@@ -179,6 +449,7 @@ namespace stardust
 
 			PHYSFS_close(file);
 			file = nullptr;
+			UpdateIndexEntryForWrite(filepath);
 
 			return Status::Success;
 		}
@@ -202,6 +473,7 @@ namespace stardust
 
 			PHYSFS_close(file);
 			file = nullptr;
+			UpdateIndexEntryForWrite(filepath);
 
 			return Status::Success;
 		}
@@ -225,6 +497,7 @@ namespace stardust
 
 			PHYSFS_close(file);
 			file = nullptr;
+			UpdateIndexEntryForWrite(filepath);
 
 			return Status::Success;
 		}
@@ -3,12 +3,15 @@
 #define VFS_H
 
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "../utility/enums/Status.h"
+#include "FileView.h"
+#include "Stream.h"
 
 namespace stardust
 {
@@ -29,12 +32,17 @@ namespace stardust
 		[[nodiscard]] extern bool DoesFileExist(const std::string_view& filepath);
 		
 		[[nodiscard]] extern bool IsDirectory(const std::string_view& filepath);
+		[[nodiscard]] extern std::uint64_t GetFileSize(const std::string_view& filepath);
+		[[nodiscard]] extern std::string GetRealDirectory(const std::string_view& filepath);
 		[[nodiscard]] extern std::string GetParentFilepath(const std::string_view& filepath);
 		[[nodiscard]] extern std::string GetFilenameFromDirectory(const std::string_view& filepath);
 		[[nodiscard]] extern std::string GetFileStem(const std::string_view& filename);
 		[[nodiscard]] extern std::string GetFileExtension(const std::string_view& filename);
 
 		[[nodiscard]] extern std::vector<std::byte> ReadFileData(const std::string_view& filepath);
+		[[nodiscard]] extern FileView ReadFileView(const std::string_view& filepath);
+		[[nodiscard]] extern FileView MapFileView(const std::string_view& filepath);
+		[[nodiscard]] extern Stream OpenStream(const std::string_view& filepath, const std::size_t bufferSize = Stream::DefaultBufferSize);
 		[[nodiscard]] extern Status WriteToFile(const std::string_view& filepath, const std::vector<std::byte>& data);
 		[[nodiscard]] extern Status WriteToFile(const std::string_view& filepath, const std::string& data);
 		[[nodiscard]] extern Status AppendToFile(const std::string_view& filepath, const std::vector<std::byte>& data);
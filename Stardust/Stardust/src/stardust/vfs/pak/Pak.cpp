@@ -0,0 +1,813 @@
+#include "Pak.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <lz4.h>
+#include <lz4hc.h>
+#include <physfs/physfs.h>
+
+#include "../../debug/logging/Log.h"
+#include "../../utility/binary/Binary.h"
+#include "../../utility/string_id/StringID.h"
+
+namespace stardust
+{
+	namespace vfs
+	{
+		namespace pak
+		{
+			namespace
+			{
+				constexpr std::array<char, 4u> FileMagic{ 'S', 'D', 'P', 'K' };
+				constexpr std::uint16_t FileVersion = 1u;
+				constexpr std::size_t HeaderSize = 20u;
+				constexpr std::size_t EntryRecordSize = 40u;
+				constexpr std::uint32_t EmptyBucket = std::numeric_limits<std::uint32_t>::max();
+				constexpr std::uint8_t DirectoryFlag = 0x01u;
+
+				constexpr std::size_t MinCompressedEntrySize = 64u;
+				constexpr std::size_t MaxCompressedEntrySize = 16'000'000u;
+
+				struct Entry
+				{
+					std::uint64_t pathHash;
+					std::string path;
+
+					Codec codec;
+					bool isDirectory;
+
+					std::uint64_t dataOffset;
+					std::uint64_t compressedSize;
+					std::uint64_t uncompressedSize;
+				};
+
+				struct Archive
+				{
+					PHYSFS_Io* io;
+					std::string filepath;
+
+					std::vector<std::uint32_t> buckets;
+					std::vector<Entry> entries;
+					std::unordered_map<std::string, std::vector<std::uint32_t>> directoryChildren;
+				};
+
+				struct EntryReader
+				{
+					PHYSFS_Io* archiveIo;
+					const Entry* entry;
+					std::shared_ptr<const std::vector<std::byte>> decompressedData;
+					std::uint64_t position;
+				};
+
+				struct PackedEntry
+				{
+					std::string path;
+					Codec codec;
+					bool isDirectory;
+
+					std::vector<std::byte> data;
+					std::uint64_t uncompressedSize;
+				};
+
+				std::mutex s_openArchiveMutex;
+				std::unordered_map<std::string, const Archive*> s_openArchives{ };
+
+				[[nodiscard]] bool ReadFromIo(PHYSFS_Io* const io, std::vector<std::byte>& out_data, const std::size_t byteCount)
+				{
+					out_data.resize(byteCount);
+
+					return io->read(io, out_data.data(), static_cast<PHYSFS_uint64>(byteCount)) == static_cast<PHYSFS_sint64>(byteCount);
+				}
+
+				[[nodiscard]] std::uint64_t AlignEntryOffset(const std::uint64_t offset) noexcept
+				{
+					return (offset + EntryAlignment - 1u) / EntryAlignment * EntryAlignment;
+				}
+
+				[[nodiscard]] std::string GetParentPath(const std::string& path)
+				{
+					const std::size_t separatorPosition = path.rfind('/');
+
+					return separatorPosition == std::string::npos ? std::string() : path.substr(0u, separatorPosition);
+				}
+
+				[[nodiscard]] std::string GetFilename(const std::string& path)
+				{
+					const std::size_t separatorPosition = path.rfind('/');
+
+					return separatorPosition == std::string::npos ? path : path.substr(separatorPosition + 1u);
+				}
+
+				[[nodiscard]] const Entry* FindEntry(const Archive& archive, const std::string_view& path)
+				{
+					const std::uint64_t pathHash = StringID::HashString(path);
+					const std::size_t bucketMask = archive.buckets.size() - 1u;
+					std::size_t bucket = static_cast<std::size_t>(pathHash) & bucketMask;
+
+					for (std::size_t probeCount = 0u; probeCount < archive.buckets.size(); ++probeCount)
+					{
+						const std::uint32_t entryIndex = archive.buckets[bucket];
+
+						if (entryIndex == EmptyBucket)
+						{
+							return nullptr;
+						}
+
+						const Entry& entry = archive.entries[entryIndex];
+
+						if (entry.pathHash == pathHash && entry.path == path)
+						{
+							return &entry;
+						}
+
+						bucket = (bucket + 1u) & bucketMask;
+					}
+
+					return nullptr;
+				}
+
+				PHYSFS_sint64 ReadEntry(PHYSFS_Io* io, void* buffer, PHYSFS_uint64 length)
+				{
+					EntryReader* const reader = static_cast<EntryReader*>(io->opaque);
+					const std::uint64_t byteCount = std::min(length, reader->entry->uncompressedSize - reader->position);
+
+					if (byteCount == 0u)
+					{
+						return 0;
+					}
+
+					if (reader->decompressedData != nullptr)
+					{
+						std::memcpy(buffer, reader->decompressedData->data() + reader->position, static_cast<std::size_t>(byteCount));
+						reader->position += byteCount;
+
+						return static_cast<PHYSFS_sint64>(byteCount);
+					}
+
+					if (reader->archiveIo->seek(reader->archiveIo, reader->entry->dataOffset + reader->position) == 0)
+					{
+						return -1;
+					}
+
+					const PHYSFS_sint64 bytesRead = reader->archiveIo->read(reader->archiveIo, buffer, byteCount);
+
+					if (bytesRead > 0)
+					{
+						reader->position += static_cast<std::uint64_t>(bytesRead);
+					}
+
+					return bytesRead;
+				}
+
+				PHYSFS_sint64 WriteEntry(PHYSFS_Io*, const void*, PHYSFS_uint64)
+				{
+					PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+
+					return -1;
+				}
+
+				int SeekEntry(PHYSFS_Io* io, PHYSFS_uint64 offset)
+				{
+					EntryReader* const reader = static_cast<EntryReader*>(io->opaque);
+
+					if (offset > reader->entry->uncompressedSize)
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_PAST_EOF);
+
+						return 0;
+					}
+
+					reader->position = offset;
+
+					return 1;
+				}
+
+				PHYSFS_sint64 TellEntry(PHYSFS_Io* io)
+				{
+					return static_cast<PHYSFS_sint64>(static_cast<const EntryReader*>(io->opaque)->position);
+				}
+
+				PHYSFS_sint64 GetEntryLength(PHYSFS_Io* io)
+				{
+					return static_cast<PHYSFS_sint64>(static_cast<const EntryReader*>(io->opaque)->entry->uncompressedSize);
+				}
+
+				PHYSFS_Io* CreateEntryIo(EntryReader&& entryReader);
+
+				PHYSFS_Io* DuplicateEntry(PHYSFS_Io* io)
+				{
+					const EntryReader* const reader = static_cast<const EntryReader*>(io->opaque);
+					PHYSFS_Io* archiveIo = nullptr;
+
+					if (reader->archiveIo != nullptr)
+					{
+						archiveIo = reader->archiveIo->duplicate(reader->archiveIo);
+
+						if (archiveIo == nullptr)
+						{
+							return nullptr;
+						}
+					}
+
+					return CreateEntryIo(EntryReader{
+						.archiveIo = archiveIo,
+						.entry = reader->entry,
+						.decompressedData = reader->decompressedData,
+						.position = 0u,
+					});
+				}
+
+				int FlushEntry(PHYSFS_Io*)
+				{
+					return 1;
+				}
+
+				void DestroyEntry(PHYSFS_Io* io)
+				{
+					EntryReader* const reader = static_cast<EntryReader*>(io->opaque);
+
+					if (reader->archiveIo != nullptr)
+					{
+						reader->archiveIo->destroy(reader->archiveIo);
+					}
+
+					delete reader;
+					delete io;
+				}
+
+				PHYSFS_Io* CreateEntryIo(EntryReader&& entryReader)
+				{
+					return new PHYSFS_Io{
+						.version = 0u,
+						.opaque = new EntryReader(std::move(entryReader)),
+						.read = ReadEntry,
+						.write = WriteEntry,
+						.seek = SeekEntry,
+						.tell = TellEntry,
+						.length = GetEntryLength,
+						.duplicate = DuplicateEntry,
+						.flush = FlushEntry,
+						.destroy = DestroyEntry,
+					};
+				}
+
+				void* OpenArchive(PHYSFS_Io* io, const char* name, int forWriting, int* claimed)
+				{
+					std::vector<std::byte> header{ };
+
+					if (io->seek(io, 0u) == 0 || !ReadFromIo(io, header, HeaderSize) || std::memcmp(header.data(), FileMagic.data(), FileMagic.size()) != 0)
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_UNSUPPORTED);
+
+						return nullptr;
+					}
+
+					*claimed = 1;
+
+					if (forWriting != 0)
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+
+						return nullptr;
+					}
+
+					std::size_t offset = FileMagic.size();
+
+					const std::uint64_t version = binary::ReadLittleEndian<std::uint64_t>(header, offset, sizeof(std::uint16_t));
+					offset += sizeof(std::uint16_t);
+
+					const std::uint64_t entryCount = binary::ReadLittleEndian<std::uint64_t>(header, offset, sizeof(std::uint32_t));
+					const std::uint64_t bucketCount = binary::ReadLittleEndian<std::uint64_t>(header, offset, sizeof(std::uint32_t));
+					const std::uint64_t stringTableSize = binary::ReadLittleEndian<std::uint64_t>(header, offset, sizeof(std::uint32_t));
+
+					const PHYSFS_sint64 archiveLength = io->length(io);
+					const std::uint64_t tableSize = bucketCount * sizeof(std::uint32_t) + entryCount * EntryRecordSize + stringTableSize;
+
+					if (version != FileVersion
+						|| bucketCount == 0u
+						|| (bucketCount & (bucketCount - 1u)) != 0u
+						|| bucketCount < entryCount
+						|| archiveLength < 0
+						|| HeaderSize + tableSize > static_cast<std::uint64_t>(archiveLength))
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_CORRUPT);
+
+						return nullptr;
+					}
+
+					std::vector<std::byte> tableData{ };
+
+					if (!ReadFromIo(io, tableData, static_cast<std::size_t>(tableSize)))
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_IO);
+
+						return nullptr;
+					}
+
+					std::unique_ptr<Archive> archive = std::make_unique<Archive>();
+					offset = 0u;
+
+					archive->buckets.reserve(static_cast<std::size_t>(bucketCount));
+
+					for (std::uint64_t i = 0u; i < bucketCount; ++i)
+					{
+						const std::uint32_t entryIndex = static_cast<std::uint32_t>(binary::ReadLittleEndian<std::uint64_t>(tableData, offset, sizeof(std::uint32_t)));
+
+						if (entryIndex != EmptyBucket && entryIndex >= entryCount)
+						{
+							PHYSFS_setErrorCode(PHYSFS_ERR_CORRUPT);
+
+							return nullptr;
+						}
+
+						archive->buckets.push_back(entryIndex);
+					}
+
+					const std::size_t stringTableOffset = static_cast<std::size_t>(bucketCount * sizeof(std::uint32_t) + entryCount * EntryRecordSize);
+					archive->entries.reserve(static_cast<std::size_t>(entryCount));
+
+					for (std::uint64_t i = 0u; i < entryCount; ++i)
+					{
+						const std::uint64_t pathHash = binary::ReadLittleEndian<std::uint64_t>(tableData, offset, sizeof(std::uint64_t));
+						const std::uint64_t pathOffset = binary::ReadLittleEndian<std::uint64_t>(tableData, offset, sizeof(std::uint32_t));
+						const std::uint64_t pathLength = binary::ReadLittleEndian<std::uint64_t>(tableData, offset, sizeof(std::uint16_t));
+						const Codec codec = static_cast<Codec>(binary::ReadLittleEndian<std::uint64_t>(tableData, offset, sizeof(std::uint8_t)));
+						const std::uint64_t flags = binary::ReadLittleEndian<std::uint64_t>(tableData, offset, sizeof(std::uint8_t));
+						const std::uint64_t dataOffset = binary::ReadLittleEndian<std::uint64_t>(tableData, offset, sizeof(std::uint64_t));
+						const std::uint64_t compressedSize = binary::ReadLittleEndian<std::uint64_t>(tableData, offset, sizeof(std::uint64_t));
+						const std::uint64_t uncompressedSize = binary::ReadLittleEndian<std::uint64_t>(tableData, offset, sizeof(std::uint64_t));
+
+						const bool isValidCodec = (codec == Codec::Store && compressedSize == uncompressedSize)
+							|| (codec == Codec::LZ4 && uncompressedSize <= MaxCompressedEntrySize && compressedSize <= static_cast<std::uint64_t>(std::numeric_limits<int>::max()));
+
+						if (pathOffset + pathLength > stringTableSize
+							|| !isValidCodec
+							|| dataOffset + compressedSize > static_cast<std::uint64_t>(archiveLength))
+						{
+							PHYSFS_setErrorCode(PHYSFS_ERR_CORRUPT);
+
+							return nullptr;
+						}
+
+						std::string path(reinterpret_cast<const char*>(tableData.data() + stringTableOffset + pathOffset), static_cast<std::size_t>(pathLength));
+						archive->directoryChildren[GetParentPath(path)].push_back(static_cast<std::uint32_t>(i));
+
+						archive->entries.push_back(Entry{
+							.pathHash = pathHash,
+							.path = std::move(path),
+							.codec = codec,
+							.isDirectory = (flags & DirectoryFlag) != 0u,
+							.dataOffset = dataOffset,
+							.compressedSize = compressedSize,
+							.uncompressedSize = uncompressedSize,
+						});
+					}
+
+					archive->io = io;
+					archive->filepath = name;
+
+					{
+						const std::scoped_lock<std::mutex> lock(s_openArchiveMutex);
+						s_openArchives[archive->filepath] = archive.get();
+					}
+
+					return archive.release();
+				}
+
+				PHYSFS_EnumerateCallbackResult EnumerateArchive(void* opaque, const char* directory, PHYSFS_EnumerateCallback callback, const char* originalDirectory, void* callbackData)
+				{
+					const Archive* const archive = static_cast<const Archive*>(opaque);
+					const auto childrenLocation = archive->directoryChildren.find(directory);
+
+					if (childrenLocation == std::cend(archive->directoryChildren))
+					{
+						return PHYSFS_ENUM_OK;
+					}
+
+					for (const std::uint32_t entryIndex : childrenLocation->second)
+					{
+						const std::string filename = GetFilename(archive->entries[entryIndex].path);
+
+						switch (callback(callbackData, originalDirectory, filename.c_str()))
+						{
+						case PHYSFS_ENUM_ERROR:
+							PHYSFS_setErrorCode(PHYSFS_ERR_APP_CALLBACK);
+
+							return PHYSFS_ENUM_ERROR;
+
+						case PHYSFS_ENUM_STOP:
+							return PHYSFS_ENUM_STOP;
+
+						case PHYSFS_ENUM_OK:
+						default:
+							break;
+						}
+					}
+
+					return PHYSFS_ENUM_OK;
+				}
+
+				PHYSFS_Io* OpenEntryForReading(void* opaque, const char* filepath)
+				{
+					const Archive* const archive = static_cast<const Archive*>(opaque);
+					const Entry* const entry = FindEntry(*archive, filepath);
+
+					if (entry == nullptr)
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_NOT_FOUND);
+
+						return nullptr;
+					}
+
+					if (entry->isDirectory)
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_NOT_A_FILE);
+
+						return nullptr;
+					}
+
+					PHYSFS_Io* const archiveIo = archive->io->duplicate(archive->io);
+
+					if (archiveIo == nullptr)
+					{
+						return nullptr;
+					}
+
+					if (entry->codec == Codec::Store)
+					{
+						return CreateEntryIo(EntryReader{
+							.archiveIo = archiveIo,
+							.entry = entry,
+							.decompressedData = nullptr,
+							.position = 0u,
+						});
+					}
+
+					std::vector<std::byte> compressedData{ };
+					const bool didReadEntry = archiveIo->seek(archiveIo, entry->dataOffset) != 0 && ReadFromIo(archiveIo, compressedData, static_cast<std::size_t>(entry->compressedSize));
+					archiveIo->destroy(archiveIo);
+
+					if (!didReadEntry)
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_IO);
+
+						return nullptr;
+					}
+
+					const std::shared_ptr<std::vector<std::byte>> decompressedData = std::make_shared<std::vector<std::byte>>(static_cast<std::size_t>(entry->uncompressedSize));
+
+					const int decompressedSize = LZ4_decompress_safe(
+						reinterpret_cast<const char*>(compressedData.data()),
+						reinterpret_cast<char*>(decompressedData->data()),
+						static_cast<int>(entry->compressedSize),
+						static_cast<int>(entry->uncompressedSize)
+					);
+
+					if (decompressedSize != static_cast<int>(entry->uncompressedSize))
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_CORRUPT);
+
+						return nullptr;
+					}
+
+					return CreateEntryIo(EntryReader{
+						.archiveIo = nullptr,
+						.entry = entry,
+						.decompressedData = decompressedData,
+						.position = 0u,
+					});
+				}
+
+				PHYSFS_Io* OpenEntryForWriting(void*, const char*)
+				{
+					PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+
+					return nullptr;
+				}
+
+				int ModifyArchive(void*, const char*)
+				{
+					PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+
+					return 0;
+				}
+
+				int StatEntry(void* opaque, const char* filepath, PHYSFS_Stat* stat)
+				{
+					const Archive* const archive = static_cast<const Archive*>(opaque);
+					const bool isRootDirectory = *filepath == '\0';
+					const Entry* const entry = isRootDirectory ? nullptr : FindEntry(*archive, filepath);
+
+					if (!isRootDirectory && entry == nullptr)
+					{
+						PHYSFS_setErrorCode(PHYSFS_ERR_NOT_FOUND);
+
+						return 0;
+					}
+
+					const bool isDirectory = isRootDirectory || entry->isDirectory;
+
+					stat->filesize = isDirectory ? 0 : static_cast<PHYSFS_sint64>(entry->uncompressedSize);
+					stat->modtime = -1;
+					stat->createtime = -1;
+					stat->accesstime = -1;
+					stat->filetype = isDirectory ? PHYSFS_FILETYPE_DIRECTORY : PHYSFS_FILETYPE_REGULAR;
+					stat->readonly = 1;
+
+					return 1;
+				}
+
+				void CloseArchive(void* opaque)
+				{
+					Archive* const archive = static_cast<Archive*>(opaque);
+
+					{
+						const std::scoped_lock<std::mutex> lock(s_openArchiveMutex);
+						s_openArchives.erase(archive->filepath);
+					}
+
+					archive->io->destroy(archive->io);
+					delete archive;
+				}
+
+				const PHYSFS_Archiver s_Archiver{
+					.version = 0u,
+					.info = PHYSFS_ArchiveInfo{
+						.extension = "SDPAK",
+						.description = "Stardust indexed archive",
+						.author = "Stardust",
+						.url = "",
+						.supportsSymlinks = 0,
+					},
+					.openArchive = OpenArchive,
+					.enumerate = EnumerateArchive,
+					.openRead = OpenEntryForReading,
+					.openWrite = OpenEntryForWriting,
+					.openAppend = OpenEntryForWriting,
+					.remove = ModifyArchive,
+					.mkdir = ModifyArchive,
+					.stat = StatEntry,
+					.closeArchive = CloseArchive,
+				};
+
+				[[nodiscard]] bool ReadSourceFile(const std::filesystem::path& filepath, std::vector<std::byte>& out_data)
+				{
+					std::ifstream sourceFile(filepath, std::ios_base::binary);
+
+					if (!sourceFile.is_open())
+					{
+						return false;
+					}
+
+					const std::string sourceData{ std::istreambuf_iterator<char>(sourceFile), std::istreambuf_iterator<char>() };
+					out_data.resize(sourceData.size());
+					std::memcpy(out_data.data(), sourceData.data(), sourceData.size());
+
+					return true;
+				}
+
+				void CompressEntry(PackedEntry& packedEntry)
+				{
+					if (packedEntry.data.size() < MinCompressedEntrySize || packedEntry.data.size() > MaxCompressedEntrySize)
+					{
+						return;
+					}
+
+					std::vector<std::byte> compressedData(static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(packedEntry.data.size()))));
+					const int compressedSize = LZ4_compress_HC(
+						reinterpret_cast<const char*>(packedEntry.data.data()),
+						reinterpret_cast<char*>(compressedData.data()),
+						static_cast<int>(packedEntry.data.size()),
+						static_cast<int>(compressedData.size()),
+						LZ4HC_CLEVEL_MAX
+					);
+
+					if (compressedSize <= 0 || static_cast<std::size_t>(compressedSize) >= packedEntry.data.size() - packedEntry.data.size() / 10u)
+					{
+						return;
+					}
+
+					compressedData.resize(static_cast<std::size_t>(compressedSize));
+
+					packedEntry.codec = Codec::LZ4;
+					packedEntry.data = std::move(compressedData);
+				}
+			}
+
+			[[nodiscard]] bool RegisterArchiver()
+			{
+				return PHYSFS_registerArchiver(&s_Archiver) != 0;
+			}
+
+			[[nodiscard]] std::optional<StoredEntryLocation> FindStoredEntry(const std::string_view& archiveFilepath, const std::string_view& filepath)
+			{
+				const std::scoped_lock<std::mutex> lock(s_openArchiveMutex);
+				const auto archiveLocation = s_openArchives.find(std::string(archiveFilepath));
+
+				if (archiveLocation == std::cend(s_openArchives))
+				{
+					return std::nullopt;
+				}
+
+				const Entry* const entry = FindEntry(*archiveLocation->second, filepath);
+
+				if (entry == nullptr || entry->isDirectory || entry->codec != Codec::Store || entry->uncompressedSize == 0u)
+				{
+					return std::nullopt;
+				}
+
+				return StoredEntryLocation{
+					.offset = entry->dataOffset,
+					.size = static_cast<std::size_t>(entry->uncompressedSize),
+				};
+			}
+
+			[[nodiscard]] Status PackDirectory(const std::filesystem::path& sourceDirectory, const std::filesystem::path& destinationFilepath)
+			{
+				std::error_code errorCode;
+
+				if (!std::filesystem::is_directory(sourceDirectory, errorCode))
+				{
+					return Status::Fail;
+				}
+
+				std::vector<PackedEntry> packedEntries{ };
+
+				for (const auto& directoryEntry : std::filesystem::recursive_directory_iterator(sourceDirectory, errorCode))
+				{
+					std::string entryPath = std::filesystem::relative(directoryEntry.path(), sourceDirectory).generic_string();
+
+					if (entryPath.length() > std::numeric_limits<std::uint16_t>::max())
+					{
+						Log::EngineError("Path {} is too long to be packed.", entryPath);
+
+						return Status::Fail;
+					}
+
+					if (directoryEntry.is_directory())
+					{
+						packedEntries.push_back(PackedEntry{
+							.path = std::move(entryPath),
+							.codec = Codec::Store,
+							.isDirectory = true,
+							.data = { },
+							.uncompressedSize = 0u,
+						});
+
+						continue;
+					}
+
+					if (!directoryEntry.is_regular_file())
+					{
+						continue;
+					}
+
+					PackedEntry packedEntry{
+						.path = std::move(entryPath),
+						.codec = Codec::Store,
+						.isDirectory = false,
+						.data = { },
+						.uncompressedSize = 0u,
+					};
+
+					if (!ReadSourceFile(directoryEntry.path(), packedEntry.data))
+					{
+						Log::EngineError("Failed to read {} for packing.", directoryEntry.path().string());
+
+						return Status::Fail;
+					}
+
+					packedEntry.uncompressedSize = packedEntry.data.size();
+					CompressEntry(packedEntry);
+
+					packedEntries.push_back(std::move(packedEntry));
+				}
+
+				if (errorCode || packedEntries.size() >= EmptyBucket)
+				{
+					return Status::Fail;
+				}
+
+				std::ranges::sort(packedEntries, { }, &PackedEntry::path);
+
+				std::uint64_t bucketCount = 1u;
+
+				while (bucketCount < packedEntries.size() * 2u)
+				{
+					bucketCount <<= 1u;
+				}
+
+				std::vector<std::uint32_t> buckets(static_cast<std::size_t>(bucketCount), EmptyBucket);
+
+				for (std::size_t i = 0u; i < packedEntries.size(); ++i)
+				{
+					std::size_t bucket = static_cast<std::size_t>(StringID::HashString(packedEntries[i].path) & (bucketCount - 1u));
+
+					while (buckets[bucket] != EmptyBucket)
+					{
+						bucket = (bucket + 1u) & static_cast<std::size_t>(bucketCount - 1u);
+					}
+
+					buckets[bucket] = static_cast<std::uint32_t>(i);
+				}
+
+				std::string stringTable{ };
+
+				for (const auto& packedEntry : packedEntries)
+				{
+					stringTable += packedEntry.path;
+				}
+
+				std::vector<std::byte> tableData(FileMagic.size());
+				std::memcpy(tableData.data(), FileMagic.data(), FileMagic.size());
+
+				binary::WriteLittleEndian(tableData, FileVersion, sizeof(std::uint16_t));
+				binary::WriteLittleEndian(tableData, 0u, sizeof(std::uint16_t));
+				binary::WriteLittleEndian(tableData, packedEntries.size(), sizeof(std::uint32_t));
+				binary::WriteLittleEndian(tableData, bucketCount, sizeof(std::uint32_t));
+				binary::WriteLittleEndian(tableData, stringTable.length(), sizeof(std::uint32_t));
+
+				for (const std::uint32_t entryIndex : buckets)
+				{
+					binary::WriteLittleEndian(tableData, entryIndex, sizeof(std::uint32_t));
+				}
+
+				const std::uint64_t tableSize = HeaderSize + bucketCount * sizeof(std::uint32_t) + packedEntries.size() * EntryRecordSize + stringTable.length();
+				std::vector<std::uint64_t> dataOffsets{ };
+				dataOffsets.reserve(packedEntries.size());
+
+				std::uint64_t dataOffset = AlignEntryOffset(tableSize);
+				std::uint64_t pathOffset = 0u;
+
+				for (const auto& packedEntry : packedEntries)
+				{
+					const std::uint64_t entryDataOffset = packedEntry.isDirectory ? 0u : dataOffset;
+					dataOffsets.push_back(entryDataOffset);
+
+					if (!packedEntry.isDirectory)
+					{
+						dataOffset = AlignEntryOffset(dataOffset + packedEntry.data.size());
+					}
+
+					binary::WriteLittleEndian(tableData, StringID::HashString(packedEntry.path), sizeof(std::uint64_t));
+					binary::WriteLittleEndian(tableData, pathOffset, sizeof(std::uint32_t));
+					binary::WriteLittleEndian(tableData, packedEntry.path.length(), sizeof(std::uint16_t));
+					binary::WriteLittleEndian(tableData, static_cast<std::uint64_t>(packedEntry.codec), sizeof(std::uint8_t));
+					binary::WriteLittleEndian(tableData, packedEntry.isDirectory ? DirectoryFlag : 0u, sizeof(std::uint8_t));
+					binary::WriteLittleEndian(tableData, entryDataOffset, sizeof(std::uint64_t));
+					binary::WriteLittleEndian(tableData, packedEntry.data.size(), sizeof(std::uint64_t));
+					binary::WriteLittleEndian(tableData, packedEntry.uncompressedSize, sizeof(std::uint64_t));
+
+					pathOffset += packedEntry.path.length();
+				}
+
+				for (const char character : stringTable)
+				{
+					tableData.push_back(static_cast<std::byte>(character));
+				}
+
+				const std::array<std::byte, EntryAlignment> alignmentPadding{ };
+
+				std::vector<std::span<const std::byte>> fileChunks{ tableData };
+				fileChunks.reserve(packedEntries.size() * 2u + 1u);
+
+				std::uint64_t filePosition = tableData.size();
+
+				for (std::size_t i = 0u; i < packedEntries.size(); ++i)
+				{
+					if (packedEntries[i].isDirectory)
+					{
+						continue;
+					}
+
+					fileChunks.emplace_back(alignmentPadding.data(), static_cast<std::size_t>(dataOffsets[i] - filePosition));
+					fileChunks.emplace_back(packedEntries[i].data);
+
+					filePosition = dataOffsets[i] + packedEntries[i].data.size();
+				}
+
+				if (binary::WriteToFile(destinationFilepath, fileChunks) == Status::Fail)
+				{
+					return Status::Fail;
+				}
+
+				Log::EngineTrace("Packed {} entries from {} into {}.", packedEntries.size(), sourceDirectory.string(), destinationFilepath.string());
+
+				return Status::Success;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+#ifndef PAK_H
+#define PAK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+#include "../../utility/enums/Status.h"
+
+namespace stardust
+{
+	namespace vfs
+	{
+		namespace pak
+		{
+			enum class Codec
+				: std::uint8_t
+			{
+				Store = 0u,
+				LZ4 = 1u,
+			};
+
+			struct StoredEntryLocation
+			{
+				std::uint64_t offset;
+				std::size_t size;
+			};
+
+			constexpr const char* FileExtension = ".pak";
+			constexpr std::uint64_t EntryAlignment = 4'096u;
+
+			[[nodiscard]] extern bool RegisterArchiver();
+			[[nodiscard]] extern std::optional<StoredEntryLocation> FindStoredEntry(const std::string_view& archiveFilepath, const std::string_view& filepath);
+
+			[[nodiscard]] extern Status PackDirectory(const std::filesystem::path& sourceDirectory, const std::filesystem::path& destinationFilepath);
+		}
+	}
+}
+
+#endif
\ No newline at end of file